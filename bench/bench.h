@@ -0,0 +1,59 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
+
+/**
+ * Times each day's parse and solve functions in-process, through the day libraries.
+ */
+namespace bench {
+
+/**
+ * Returns the contents of an input file, read once and kept for the rest of the run.
+ */
+std::string_view input(const std::string &path);
+
+/**
+ * Returns an input written by tools/generate for a day, with the given knobs and the rest at
+ * their defaults, generated once and kept for the rest of the run.
+ */
+std::string_view generated(std::string_view day, std::initializer_list<std::pair<std::string_view, std::string_view>> knobs);
+
+/**
+ * Returns a copy of a voxel list repeated copies times along each axis, so that the droplets
+ * stay apart but the bounding box grows with the input.
+ */
+std::string tileVoxels(std::string_view input, unsigned copies);
+
+void registerDay11(const std::string &label, std::string_view input);
+void registerDay12(const std::string &label, std::string_view input);
+void registerDay13(const std::string &label, std::string_view input);
+void registerDay14(const std::string &label, std::string_view input);
+void registerDay15(const std::string &label, std::string_view input, int row);
+void registerDay16(const std::string &label, std::string_view input);
+void registerDay18(const std::string &label, std::string_view input);
+
+/**
+ * Times strtol against number.h's parseInteger and parseIntegerSwar, on the numbers of the
+ * bundled inputs and on ones too long for the SWAR path.
+ */
+void registerNumbers();
+
+}
@@ -0,0 +1,36 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "bench.h"
+
+#include <benchmark/benchmark.h>
+
+#include "day12.h"
+
+void bench::registerDay12(const std::string &label, std::string_view input) {
+    benchmark::RegisterBenchmark(("day12/parse/" + label).c_str(), [input](benchmark::State &state) {
+        for (auto _: state) {
+            benchmark::DoNotOptimize(day12::parseVertices(input));
+        }
+        state.SetBytesProcessed(int64_t(state.iterations() * input.size()));
+    });
+    // Building the mountain runs the shortest path search to its end
+    benchmark::RegisterBenchmark(("day12/distances/" + label).c_str(), [input](benchmark::State &state) {
+        for (auto _: state) {
+            day12::Mountain mountain(input);
+            benchmark::DoNotOptimize(mountain.distances);
+        }
+    });
+}
@@ -0,0 +1,37 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "bench.h"
+
+#include <benchmark/benchmark.h>
+
+#include "day14.h"
+
+void bench::registerDay14(const std::string &label, std::string_view input) {
+    benchmark::RegisterBenchmark(("day14/parse/" + label).c_str(), [input](benchmark::State &state) {
+        for (auto _: state) {
+            benchmark::DoNotOptimize(day14::parse(input));
+        }
+        state.SetBytesProcessed(int64_t(state.iterations() * input.size()));
+    });
+
+    // Pouring fills in the spots it is given, so each iteration starts from a fresh copy
+    auto rocks = day14::parse(input);
+    benchmark::RegisterBenchmark(("day14/pour/" + label).c_str(), [rocks](benchmark::State &state) {
+        for (auto _: state) {
+            benchmark::DoNotOptimize(day14::pourSand(rocks));
+        }
+    });
+}
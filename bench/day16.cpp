@@ -0,0 +1,42 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "bench.h"
+
+#include <benchmark/benchmark.h>
+
+#include "day16.h"
+
+void bench::registerDay16(const std::string &label, std::string_view input) {
+    benchmark::RegisterBenchmark(("day16/parse/" + label).c_str(), [input](benchmark::State &state) {
+        for (auto _: state) {
+            benchmark::DoNotOptimize(day16::parse(input));
+        }
+        state.SetBytesProcessed(int64_t(state.iterations() * input.size()));
+    });
+
+    auto network = day16::parse(input);
+    benchmark::RegisterBenchmark(("day16/search/" + label).c_str(), [network](benchmark::State &state) {
+        for (auto _: state) {
+            benchmark::DoNotOptimize(day16::solve(network, day16::Engine::Search));
+        }
+    });
+    benchmark::RegisterBenchmark(("day16/dp/" + label).c_str(), [network](benchmark::State &state) {
+        for (auto _: state) {
+            day16::PressureTable table(network, day16::TimeLimit);
+            benchmark::DoNotOptimize(table.best(network.at("AA"), day16::TimeLimit));
+        }
+    });
+}
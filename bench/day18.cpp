@@ -0,0 +1,136 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "bench.h"
+
+#include <algorithm>
+#include <format>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "day18.h"
+
+namespace {
+    uint32_t largestCoordinate(const std::vector<day18::Cube> &cubes) {
+        uint32_t largest = 0;
+        for (const auto &cube: cubes) {
+            largest = std::max({largest, cube.x, cube.y, cube.z});
+        }
+        return largest;
+    }
+
+    // Threaded benchmarks run single threaded and, where there is more than one core, on all of them
+    void threadCounts(benchmark::internal::Benchmark *b) {
+        b->ArgName("threads")->Arg(1);
+        if (auto threads = std::thread::hardware_concurrency(); threads > 1) {
+            b->Arg(threads);
+        }
+        b->UseRealTime();
+    }
+}
+
+std::string bench::tileVoxels(std::string_view input, unsigned copies) {
+    auto cubes = day18::ingest(input, 1);
+    // Leave a gap so that no copy touches its neighbours
+    auto extent = largestCoordinate(cubes) + 2;
+
+    std::string tiled;
+    for (unsigned i = 0; i < copies; i++) {
+        for (unsigned j = 0; j < copies; j++) {
+            for (unsigned k = 0; k < copies; k++) {
+                for (const auto &cube: cubes) {
+                    tiled += std::format("{},{},{}\n", cube.x + i * extent, cube.y + j * extent, cube.z + k * extent);
+                }
+            }
+        }
+    }
+    return tiled;
+}
+
+void bench::registerDay18(const std::string &label, std::string_view input) {
+    benchmark::RegisterBenchmark(("day18/ingest/" + label).c_str(), [input](benchmark::State &state) {
+        for (auto _: state) {
+            benchmark::DoNotOptimize(day18::ingest(input, size_t(state.range(0))));
+        }
+        state.SetBytesProcessed(int64_t(state.iterations() * input.size()));
+    })->Apply(threadCounts);
+
+    auto cubes = std::make_shared<std::vector<day18::Cube>>(day18::ingest(input, 1));
+    // The set engine is cubic in the bounding box, which past the real input only drags the run out
+    if (largestCoordinate(*cubes) < 32) {
+        auto set = std::make_shared<std::pmr::set<day18::Cube>>(cubes->begin(), cubes->end());
+        benchmark::RegisterBenchmark(("day18/set/" + label).c_str(), [set](benchmark::State &state) {
+            for (auto _: state) {
+                benchmark::DoNotOptimize(day18::surfaceArea(day18::findAirPockets(*set)));
+            }
+        });
+    }
+
+    for (auto [name, engine]: {std::pair{"queue", day18::FloodEngine::Queue},
+                               std::pair{"bitwise", day18::FloodEngine::Bitwise}}) {
+        benchmark::RegisterBenchmark(std::format("day18/{}/{}", name, label).c_str(),
+                                     [cubes, engine](benchmark::State &state) {
+            auto grid = day18::VoxelGrid::fromCubes(*cubes);
+            for (auto _: state) {
+                benchmark::DoNotOptimize(grid.exteriorSurfaceArea(engine, size_t(state.range(0))));
+            }
+        })->Apply(threadCounts);
+    }
+
+    benchmark::RegisterBenchmark(("day18/sparse/" + label).c_str(), [cubes](benchmark::State &state) {
+        for (auto _: state) {
+            day18::SparseVoxels store;
+            for (const auto &cube: *cubes) {
+                store.insert(cube);
+            }
+            benchmark::DoNotOptimize(store.exteriorSurfaceArea());
+        }
+    });
+
+    /*
+     * N inserts into an IncrementalDroplet against one rebuild of the same N cubes, over the
+     * first quarter, half, three quarters and all of the cubes. Both should fit O(N), and the
+     * ratio between them should not grow with the input.
+     */
+    auto prefix = [cubes](const benchmark::State &state) {
+        return cubes->size() * size_t(state.range(0)) / 4;
+    };
+    benchmark::RegisterBenchmark(("day18/incremental/" + label).c_str(), [cubes, prefix](benchmark::State &state) {
+        auto n = prefix(state);
+        for (auto _: state) {
+            day18::IncrementalDroplet droplet;
+            for (size_t i = 0; i < n; i++) {
+                droplet.insert((*cubes)[i]);
+            }
+            benchmark::DoNotOptimize(droplet.exteriorSurfaceArea());
+        }
+        state.SetComplexityN(int64_t(n));
+    })->ArgName("quarters")->DenseRange(1, 4)->Complexity(benchmark::oN);
+    benchmark::RegisterBenchmark(("day18/rebuild/" + label).c_str(), [cubes, prefix](benchmark::State &state) {
+        auto n = prefix(state);
+        for (auto _: state) {
+            day18::SparseVoxels store;
+            for (size_t i = 0; i < n; i++) {
+                store.insert((*cubes)[i]);
+            }
+            benchmark::DoNotOptimize(store.exteriorSurfaceArea());
+        }
+        state.SetComplexityN(int64_t(n));
+    })->ArgName("quarters")->DenseRange(1, 4)->Complexity(benchmark::oN);
+}
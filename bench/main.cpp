@@ -0,0 +1,160 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "bench.h"
+
+#include <format>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <benchmark/benchmark.h>
+
+#include "aoc/cpu.h"
+#include "aoc/input.h"
+#include "aoc/number.h"
+#include "generators.h"
+
+std::string_view bench::input(const std::string &path) {
+    static std::map<std::string, std::string> contents;
+    auto it = contents.find(path);
+    if (it == contents.end()) {
+        aoc::InputFile file(path);
+        it = contents.emplace(path, file.contents()).first;
+    }
+    return it->second;
+}
+
+std::string_view bench::generated(std::string_view day,
+                                  std::initializer_list<std::pair<std::string_view, std::string_view>> knobs) {
+    static std::map<std::string, std::string> contents;
+    auto key = std::string(day);
+    generate::Options options;
+    for (const auto &[name, value]: knobs) {
+        key += std::format(" --{}={}", name, value);
+        options.set(name, value);
+    }
+    auto it = contents.find(key);
+    if (it == contents.end()) {
+        std::ostringstream out;
+        generate::write(day, options, out);
+        it = contents.emplace(key, std::move(out).str()).first;
+    }
+    return it->second;
+}
+
+namespace {
+    std::string_view bundled(const std::string &name) {
+        return bench::input(AOC_INPUT_DIR "/" + name);
+    }
+
+    /**
+     * Registers a day's benchmarks for an extra input given as dayNN=PATH, or day15=PATH:ROW.
+     */
+    void registerExtra(std::string_view arg) {
+        auto equals = arg.find('=');
+        if (equals == std::string_view::npos) {
+            throw std::runtime_error(std::format("Expected dayNN=PATH but got '{}'", arg));
+        }
+        auto day = arg.substr(0, equals);
+        auto path = std::string(arg.substr(equals + 1));
+        auto label = path.substr(path.find_last_of('/') + 1);
+        if (day == "day11") {
+            bench::registerDay11(label, bench::input(path));
+        } else if (day == "day12") {
+            bench::registerDay12(label, bench::input(path));
+        } else if (day == "day13") {
+            bench::registerDay13(label, bench::input(path));
+        } else if (day == "day14") {
+            bench::registerDay14(label, bench::input(path));
+        } else if (day == "day15") {
+            auto colon = path.find_last_of(':');
+            if (colon == std::string::npos) {
+                throw std::runtime_error(std::format("Expected day15=PATH:ROW but got '{}'", arg));
+            }
+            auto row = aoc::parseNumber<int>(std::string_view(path).substr(colon + 1));
+            path.resize(colon);
+            bench::registerDay15(label.substr(0, label.find_last_of(':')), bench::input(path), row);
+        } else if (day == "day16") {
+            bench::registerDay16(label, bench::input(path));
+        } else if (day == "day18") {
+            bench::registerDay18(label, bench::input(path));
+        } else {
+            throw std::runtime_error(std::format("Unknown day '{}'", day));
+        }
+    }
+}
+
+int main(int argc, char **argv)
+try {
+    // Takes out the --benchmark_* flags, such as --benchmark_format=json, leaving extra inputs
+    // and --isa
+    benchmark::Initialize(&argc, argv);
+
+    bench::registerDay11("test", bundled("day11_test.txt"));
+    bench::registerDay11("real", bundled("day11.txt"));
+    bench::registerDay12("test", bundled("day12_test.txt"));
+    bench::registerDay12("real", bundled("day12.txt"));
+    bench::registerDay13("test", bundled("day13_test.txt"));
+    bench::registerDay13("real", bundled("day13.txt"));
+    bench::registerDay14("test", bundled("day14_test.txt"));
+    bench::registerDay14("real", bundled("day14.txt"));
+    bench::registerDay15("test", bundled("day15_test.txt"), 10);
+    bench::registerDay15("real", bundled("day15.txt"), 2000000);
+    bench::registerDay16("test", bundled("day16_test.txt"));
+    bench::registerDay16("real", bundled("day16.txt"));
+    bench::registerDay18("test", bundled("day18_test.txt"));
+    bench::registerDay18("real", bundled("day18.txt"));
+
+    // Generated inputs past the size of the real ones, to see how each day grows with its
+    // input. Each label gives the growth over the generator's defaults, kept to what the day
+    // solves in seconds: day12's search is quadratic in the map, and day14 in the depth.
+    bench::registerDay11("generated-x100", bench::generated("day11", {{"items", "3600"}}));
+    bench::registerDay12("generated-x2", bench::generated("day12", {{"width", "320"}}));
+    bench::registerDay13("generated-x100", bench::generated("day13", {{"pairs", "15000"}}));
+    bench::registerDay14("generated-x2", bench::generated("day14", {{"paths", "300"}, {"depth", "340"}}));
+    // The generator's default size puts the row at 2000000, as in the real puzzle
+    bench::registerDay15("generated-x10", bench::generated("day15", {{"sensors", "300"}}), 2000000);
+    bench::registerDay16("generated-x10", bench::generated("day16", {{"valves", "600"}}));
+    bench::registerDay18("generated-x125", bench::generated("day18", {{"size", "100"}}));
+
+    // Scaled copies of the real droplet, to see how each engine grows with the bounding box
+    static const auto x8 = bench::tileVoxels(bundled("day18.txt"), 2);
+    static const auto x64 = bench::tileVoxels(bundled("day18.txt"), 4);
+    bench::registerDay18("real-x8", x8);
+    bench::registerDay18("real-x64", x64);
+
+    bench::registerNumbers();
+
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg.starts_with("--isa=")) {
+            aoc::cpu::select(aoc::cpu::parseIsa(arg.substr(6)));
+        } else {
+            registerExtra(arg);
+        }
+    }
+    benchmark::AddCustomContext("isa", std::string(aoc::cpu::name(aoc::cpu::selected())));
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+} catch (const std::exception &ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
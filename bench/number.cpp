@@ -0,0 +1,105 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "bench.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "aoc/number.h"
+
+namespace {
+    // Every integer in text, each followed by ", ", as the days come across them in their inputs
+    std::string numbersIn(std::string_view text, size_t &count) {
+        std::string numbers;
+        for (size_t i = 0; i < text.size(); i++) {
+            bool negative = text[i] == '-' && i + 1 < text.size() && std::isdigit(static_cast<unsigned char>(text[i + 1]));
+            if (!negative && !std::isdigit(static_cast<unsigned char>(text[i]))) {
+                continue;
+            }
+            auto end = i + 1;
+            while (end < text.size() && std::isdigit(static_cast<unsigned char>(text[end]))) {
+                end++;
+            }
+            numbers.append(text.substr(i, end - i)).append(", ");
+            count++;
+            i = end;
+        }
+        return numbers;
+    }
+
+    // Numbers of 8 to 18 digits, which the SWAR path leaves to std::from_chars
+    std::string longNumbers(size_t count) {
+        std::mt19937_64 random(2022);
+        std::string numbers;
+        for (size_t i = 0; i < count; i++) {
+            auto digits = 8 + random() % 11;
+            numbers += char('1' + random() % 9);
+            for (size_t d = 1; d < digits; d++) {
+                numbers += char('0' + random() % 10);
+            }
+            numbers += ", ";
+        }
+        return numbers;
+    }
+
+    template <typename Parse>
+    void registerParser(const std::string &name, const std::string &numbers, size_t count, Parse parse) {
+        benchmark::RegisterBenchmark(name.c_str(), [&numbers, count, parse](benchmark::State &state) {
+            for (auto _: state) {
+                std::string_view rest = numbers;
+                int64_t sum = 0;
+                while (!rest.empty()) {
+                    auto [value, length] = parse(rest);
+                    sum += value;
+                    rest.remove_prefix(length + 2);
+                }
+                benchmark::DoNotOptimize(sum);
+            }
+            state.SetItemsProcessed(int64_t(state.iterations() * count));
+            state.SetBytesProcessed(int64_t(state.iterations() * numbers.size()));
+        });
+    }
+
+    void registerParsers(const std::string &label, const std::string &numbers, size_t count) {
+        // The numbers are followed by ", ", so strtol stops where the others do
+        registerParser("number/strtol/" + label, numbers, count, [](std::string_view str) {
+            char *end;
+            auto value = std::strtoll(str.data(), &end, 10);
+            return aoc::ParseResult<int64_t>{value, size_t(end - str.data())};
+        });
+        registerParser("number/from_chars/" + label, numbers, count, aoc::parseInteger<int64_t>);
+        registerParser("number/swar/" + label, numbers, count, aoc::parseIntegerSwar<int64_t>);
+    }
+}
+
+void bench::registerNumbers() {
+    static size_t realCount = 0;
+    static const auto real = [] {
+        std::string text;
+        for (auto name: {"day11.txt", "day14.txt", "day15.txt", "day16.txt", "day18.txt"}) {
+            text += bench::input(AOC_INPUT_DIR "/" + std::string(name));
+        }
+        return numbersIn(text, realCount);
+    }();
+    static const size_t longCount = 100000;
+    static const auto tooLong = longNumbers(longCount);
+    registerParsers("real", real, realCount);
+    registerParsers("long", tooLong, longCount);
+}
@@ -0,0 +1,107 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aoc/json.h"
+#include "aoc/thread_pool.h"
+
+namespace aoc {
+
+/**
+ * The arguments of a day's executable, with each @FILE replaced by the arguments listed in
+ * that manifest: whitespace separated, usually one input per line, skipping blank lines and
+ * lines starting with '#'. Paths in a manifest are relative to the working directory.
+ */
+std::vector<std::string> expandArguments(int argc, char **argv);
+
+// Parses the value of a --jobs=N flag, where 0 means one job per hardware thread
+size_t parseJobs(std::string_view value);
+
+class Batch;
+
+/**
+ * Applies an option that every day's executable takes: --stats, --isa=, --jobs= or --format=.
+ * Returns false if arg is not an option at all, so names an input, and throws for an option
+ * that is unknown; executables check for their own options first.
+ */
+bool parseCommonOption(std::string_view arg, Batch &batch);
+
+/**
+ * The inputs of one invocation, solved side by side by up to a fixed number of jobs, with
+ * what each run returns printed to standard output in the order the runs were added. A run
+ * that throws has its error printed in its place, and does not stop the others.
+ *
+ * With a single job, the default, each run happens within add() itself, as the executables
+ * always did, and with --stats each run's stats follow its output. With more, runs overlap,
+ * so the stats are reported once, for the whole batch, by finish().
+ *
+ * With --format=json each run returns a JSON object of its answers, and is printed as one
+ * line {"input": ..., "answers": {...}, "seconds": ..., "stats": {...}}, or with "error" in
+ * place of "answers" if it threw. Batch-wide stats are then a last line {"stats": {...}}.
+ */
+class Batch {
+    struct Slot {
+        bool done = false;
+        bool failed = false;
+        std::string text;
+    };
+
+    size_t jobCount = 1;
+    Format outputFormat = Format::Text;
+    size_t added = 0;
+    size_t failures = 0;
+    std::mutex mutex;
+    // The runs not yet printed, the first of them being run number printed
+    std::deque<Slot> pending;
+    size_t printed = 0;
+    // Last, so that it finishes every run before the rest is destroyed
+    std::optional<ThreadPool> pool;
+
+    void complete(size_t index, Slot slot);
+
+public:
+    Batch() = default;
+
+    Batch(const Batch &) = delete;
+    Batch &operator=(const Batch &) = delete;
+
+    // Throws if any run has already been added
+    void setJobs(size_t jobs);
+
+    // Throws if any run has already been added
+    void setFormat(Format format);
+
+    [[nodiscard]] size_t jobs() const noexcept { return jobCount; }
+    [[nodiscard]] Format format() const noexcept { return outputFormat; }
+    [[nodiscard]] size_t size() const noexcept { return added; }
+
+    // Adds a run for input, which names it in JSON output; it returns text or JSON by format()
+    void add(std::string input, std::function<std::string()> run);
+
+    // Waits for every run to be printed, returning the exit status: 1 if any of them failed
+    int finish();
+};
+
+}
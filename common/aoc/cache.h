@@ -0,0 +1,157 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace aoc {
+
+/**
+ * A directory of things worked out from inputs on earlier runs: answers, and preprocessed
+ * forms that are quicker to load than to rebuild. Each entry is a file named by its kind and
+ * the hash of its key and input, and begins with a header line repeating the key, the size
+ * of the input, a second hash of the input with a different seed and the size of the value.
+ * That is checked on loading, so a truncated file or a different key is only a miss. A
+ * different input is only mistaken for the one stored if it has the same size and collides
+ * in both 64 bit hashes at once.
+ *
+ * Keys describe everything the entry depends on other than the input, including a version
+ * that is bumped whenever the code producing the entry changes what it would produce.
+ * Entries are written to a temporary file and renamed into place, so concurrent runs never
+ * see half an entry.
+ */
+class DiskCache {
+    std::filesystem::path directory;
+
+    [[nodiscard]] std::filesystem::path pathOf(std::string_view kind, std::string_view key,
+                                               std::string_view input) const;
+
+public:
+    explicit DiskCache(std::filesystem::path directory);
+
+    // $AOC_CACHE_DIR if set, otherwise aoc under $XDG_CACHE_HOME or ~/.cache
+    static std::filesystem::path defaultDirectory();
+
+    [[nodiscard]] std::optional<std::string> load(std::string_view kind, std::string_view key,
+                                                  std::string_view input) const;
+
+    void store(std::string_view kind, std::string_view key, std::string_view input, std::string_view value) const;
+
+    // As store, but a failure is only a warning on stderr, as the value is still good to use
+    void storeOrWarn(std::string_view kind, std::string_view key, std::string_view input,
+                     std::string_view value) const noexcept;
+
+    // Loads the entry, or makes and stores it if there is none
+    template <typename Make>
+    std::string fetch(std::string_view kind, std::string_view key, std::string_view input, Make &&make) const {
+        if (auto value = load(kind, key, input)) {
+            return std::move(*value);
+        }
+        std::string value = make();
+        storeOrWarn(kind, key, input, value);
+        return value;
+    }
+
+    /**
+     * Loads the entry and unpacks it, or makes, stores and unpacks it if there is none. An
+     * entry that unpack throws on is corrupt, so it is a miss too, and is overwritten.
+     */
+    template <typename Make, typename Unpack>
+    auto fetch(std::string_view kind, std::string_view key, std::string_view input, Make &&make,
+               Unpack &&unpack) const {
+        if (auto value = load(kind, key, input)) {
+            try {
+                return unpack(std::string_view(*value));
+            } catch (const std::exception &) {
+                // Rebuilt below
+            }
+        }
+        std::string value = make();
+        storeOrWarn(kind, key, input, value);
+        return unpack(std::string_view(value));
+    }
+};
+
+/**
+ * Builds a cache entry from trivially copyable values, and arrays of them prefixed by their
+ * length, in native byte order. Entries are only ever read back on the machine that wrote
+ * them, so there is no need for anything portable.
+ */
+class Packer {
+    std::string bytes;
+
+public:
+    template <typename T> requires std::is_trivially_copyable_v<T>
+    void put(const T &value) {
+        bytes.append(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+
+    template <typename T> requires std::is_trivially_copyable_v<T>
+    void putArray(std::span<const T> values) {
+        put(uint64_t(values.size()));
+        bytes.append(reinterpret_cast<const char *>(values.data()), values.size_bytes());
+    }
+
+    [[nodiscard]] std::string take() noexcept { return std::move(bytes); }
+};
+
+// Reads back what a Packer wrote, in the same order; throws if the entry is too short
+class Unpacker {
+    std::string_view bytes;
+
+    const char *consume(size_t size) {
+        if (bytes.size() < size) {
+            throw std::runtime_error("Truncated cache entry");
+        }
+        auto data = bytes.data();
+        bytes.remove_prefix(size);
+        return data;
+    }
+
+public:
+    explicit Unpacker(std::string_view bytes) noexcept : bytes(bytes) {}
+
+    template <typename T> requires std::is_trivially_copyable_v<T>
+    T get() {
+        T value;
+        std::memcpy(&value, consume(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    template <typename T> requires std::is_trivially_copyable_v<T>
+    std::vector<T> getArray() {
+        auto count = get<uint64_t>();
+        if (count > bytes.size() / sizeof(T)) {
+            throw std::runtime_error("Truncated cache entry");
+        }
+        std::vector<T> values(count);
+        std::memcpy(values.data(), consume(count * sizeof(T)), count * sizeof(T));
+        return values;
+    }
+
+    [[nodiscard]] bool done() const noexcept { return bytes.empty(); }
+};
+
+}
@@ -0,0 +1,127 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+/**
+ * Runtime selection between variants of a kernel compiled for different instruction sets,
+ * so that one binary uses AVX2 or AVX-512 where the CPU has them and still runs where it
+ * does not. Variants are ordinary functions marked with AOC_TARGET, for example
+ *
+ *   AOC_TARGET("avx2") void sumAvx2(...);
+ *   aoc::cpu::Kernel<decltype(&sumScalar)> sum("sum", sumScalar, {}, sumAvx2);
+ *
+ * and calling the kernel calls the best variant the CPU, and any --isa override, allows.
+ */
+
+#if defined(__x86_64__) || defined(__i386__)
+#define AOC_X86 1
+#define AOC_TARGET(isa) __attribute__((target(isa)))
+#else
+#define AOC_X86 0
+#define AOC_TARGET(isa)
+#endif
+
+namespace aoc::cpu {
+
+// In increasing order, each level implying those before it
+enum class Isa : uint8_t {
+    Scalar,
+    // SSE4.2 and POPCNT
+    Sse42,
+    // AVX2, BMI2 and FMA
+    Avx2,
+    // AVX-512 F, BW and VL
+    Avx512,
+};
+
+constexpr size_t IsaCount = 4;
+
+std::string_view name(Isa isa) noexcept;
+
+// Parses the value of an --isa=scalar|sse4.2|avx2|avx512 flag
+Isa parseIsa(std::string_view name);
+
+// The best level this CPU and operating system support, found once with cpuid
+Isa detected() noexcept;
+
+// The level kernels are currently choosing up to
+Isa selected() noexcept;
+
+/**
+ * Caps the level every kernel chooses at isa, for testing each path. Throws if the CPU
+ * does not support it.
+ */
+void select(Isa isa);
+
+namespace detail {
+    class KernelBase {
+    public:
+        const std::string_view name;
+
+        explicit KernelBase(std::string_view name) : name(name) {}
+        KernelBase(const KernelBase &) = delete;
+        KernelBase &operator=(const KernelBase &) = delete;
+
+        virtual void choose(Isa cap) noexcept = 0;
+
+    protected:
+        ~KernelBase() = default;
+    };
+
+    // Registers a kernel for life, so it must have static storage duration, and chooses its variant
+    void add(KernelBase *kernel);
+}
+
+/**
+ * A function with variants for each Isa level, of which any but the scalar one may be left
+ * out. Chooses the best usable variant on construction and again whenever select() is called.
+ */
+template <typename Fn>
+class Kernel final : detail::KernelBase {
+    std::array<Fn, IsaCount> variants;
+    std::atomic<Fn> chosen;
+    std::atomic<Isa> chosenIsa;
+
+    void choose(Isa cap) noexcept override {
+        auto level = size_t(cap);
+        while (level > 0 && !variants[level]) {
+            level--;
+        }
+        chosenIsa.store(Isa(level), std::memory_order_relaxed);
+        chosen.store(variants[level], std::memory_order_relaxed);
+    }
+
+public:
+    Kernel(std::string_view name, Fn scalar, Fn sse42 = nullptr, Fn avx2 = nullptr, Fn avx512 = nullptr)
+            : KernelBase(name), variants{scalar, sse42, avx2, avx512} {
+        detail::add(this);
+    }
+
+    template <typename... Args>
+    decltype(auto) operator()(Args &&...args) const {
+        return chosen.load(std::memory_order_relaxed)(std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] Isa isa() const noexcept { return chosenIsa.load(std::memory_order_relaxed); }
+};
+
+}
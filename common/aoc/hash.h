@@ -0,0 +1,29 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace aoc {
+
+/**
+ * XXH64 of some bytes: a fast, well distributed, non-cryptographic hash used to recognise
+ * inputs that have been seen before by their contents alone.
+ */
+uint64_t hashBytes(std::string_view bytes, uint64_t seed = 0) noexcept;
+
+}
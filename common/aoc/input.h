@@ -0,0 +1,156 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace aoc {
+
+/**
+ * Returns the first '\n' in [begin, end), or end if there is none, comparing a vector
+ * register's worth of bytes at a time with the widest one the CPU has.
+ */
+const char *findNewline(const char *begin, const char *end) noexcept;
+
+/**
+ * The lines of some text, as views into it. Like std::getline, a trailing newline does not
+ * start another line, and a '\r' before a newline is dropped.
+ */
+class Lines {
+    std::string_view text;
+
+public:
+    class iterator {
+        const char *next = nullptr;
+        const char *end = nullptr;
+        std::string_view line;
+        bool done = true;
+
+        void advance() noexcept;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view *;
+        using reference = const std::string_view &;
+
+        iterator() = default;
+
+        iterator(const char *begin, const char *end) noexcept : next(begin), end(end), done(false) { advance(); }
+
+        reference operator*() const noexcept { return line; }
+        pointer operator->() const noexcept { return &line; }
+
+        iterator &operator++() noexcept {
+            advance();
+            return *this;
+        }
+
+        iterator operator++(int) noexcept {
+            auto copy = *this;
+            advance();
+            return copy;
+        }
+
+        bool operator==(const iterator &other) const noexcept {
+            return done == other.done && (done || line.data() == other.line.data());
+        }
+    };
+
+    explicit Lines(std::string_view text) noexcept : text(text) {}
+
+    [[nodiscard]] iterator begin() const noexcept { return {text.data(), text.data() + text.size()}; }
+    [[nodiscard]] iterator end() const noexcept { return {}; }
+};
+
+/**
+ * The blank line separated records of some text, each a view of its lines without the
+ * separating blank lines.
+ */
+class Records {
+    std::string_view text;
+
+public:
+    class iterator {
+        Lines::iterator line;
+        std::string_view record;
+        bool done = true;
+
+        void advance() noexcept;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view *;
+        using reference = const std::string_view &;
+
+        iterator() = default;
+
+        explicit iterator(Lines::iterator first) noexcept : line(first), done(false) { advance(); }
+
+        reference operator*() const noexcept { return record; }
+        pointer operator->() const noexcept { return &record; }
+
+        iterator &operator++() noexcept {
+            advance();
+            return *this;
+        }
+
+        iterator operator++(int) noexcept {
+            auto copy = *this;
+            advance();
+            return copy;
+        }
+
+        bool operator==(const iterator &other) const noexcept {
+            return done == other.done && (done || record.data() == other.record.data());
+        }
+    };
+
+    explicit Records(std::string_view text) noexcept : text(text) {}
+
+    [[nodiscard]] iterator begin() const noexcept { return iterator(Lines(text).begin()); }
+    [[nodiscard]] iterator end() const noexcept { return {}; }
+};
+
+/**
+ * The whole contents of an input file. Regular files are memory mapped and advised for
+ * sequential access; anything else, such as a pipe, or "-" for standard input, is read
+ * into memory.
+ */
+class InputFile {
+    std::string_view view;
+    std::string buffer;
+    void *mapping = nullptr;
+
+public:
+    explicit InputFile(const std::string &path);
+    ~InputFile();
+
+    InputFile(const InputFile &) = delete;
+    InputFile &operator=(const InputFile &) = delete;
+
+    [[nodiscard]] std::string_view contents() const noexcept { return view; }
+    [[nodiscard]] Lines lines() const noexcept { return Lines(view); }
+    [[nodiscard]] Records records() const noexcept { return Records(view); }
+};
+
+}
@@ -0,0 +1,71 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aoc {
+
+// How the executables print their answers, chosen with --format=text|json
+enum class Format : uint8_t {
+    // The "Part 1: ..." lines, as they always were
+    Text,
+    // One JSON object per input, on a line of its own
+    Json,
+};
+
+Format parseFormat(std::string_view value);
+
+// Appends value to out as a quoted and escaped JSON string
+void appendJsonString(std::string &out, std::string_view value);
+
+/**
+ * Writes a JSON object a member at a time, for --format=json. Only as much of JSON as the
+ * answers need; nested objects and arrays are added already written, with addRaw.
+ */
+class JsonObject {
+    std::string text = "{";
+
+    void key(std::string_view name);
+
+public:
+    JsonObject &add(std::string_view name, std::string_view value);
+    JsonObject &add(std::string_view name, const char *value) { return add(name, std::string_view(value)); }
+    JsonObject &add(std::string_view name, bool value);
+    JsonObject &add(std::string_view name, double value);
+
+    template <std::integral T>
+        requires (!std::same_as<T, bool>)
+    JsonObject &add(std::string_view name, T value) {
+        return addRaw(name, std::to_string(value));
+    }
+
+    JsonObject &addNull(std::string_view name) { return addRaw(name, "null"); }
+
+    // Adds json, which must already be a JSON value, such as another object's str()
+    JsonObject &addRaw(std::string_view name, std::string_view json);
+
+    [[nodiscard]] std::string str() const { return text + "}"; }
+};
+
+// A JSON array of values that are already JSON
+std::string jsonArray(const std::vector<std::string> &values);
+
+}
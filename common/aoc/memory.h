@@ -0,0 +1,56 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+
+namespace aoc {
+
+enum class Allocator : uint8_t {
+    // Plain new and delete, to compare the others against
+    Default,
+    // Bump allocation from a monotonic arena that is freed all at once
+    Arena,
+    // Size class pools carved from the arena, which reuse freed blocks for code that churns
+    Pool,
+};
+
+// Parses the value of an --alloc=default|arena|pool flag
+Allocator parseAllocator(std::string_view name);
+
+/**
+ * The memory resource for one run of a solver. The containers of a run allocate from it, and
+ * destroying it releases everything they allocated in one go, rather than node by node. A
+ * run may allocate from it from one thread only.
+ */
+class RunMemory {
+    std::optional<std::pmr::monotonic_buffer_resource> arena;
+    std::optional<std::pmr::unsynchronized_pool_resource> pool;
+    std::pmr::memory_resource *memory = std::pmr::new_delete_resource();
+
+public:
+    explicit RunMemory(Allocator allocator);
+
+    RunMemory(const RunMemory &) = delete;
+    RunMemory &operator=(const RunMemory &) = delete;
+
+    [[nodiscard]] std::pmr::memory_resource *resource() const noexcept { return memory; }
+};
+
+}
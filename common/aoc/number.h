@@ -0,0 +1,119 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace aoc {
+
+template <std::integral T>
+struct ParseResult {
+    T value;
+    // How many characters of the input made up the number
+    size_t length;
+};
+
+namespace detail {
+    [[noreturn]] inline void failedToParse(std::string_view str) {
+        // The input may be the rest of a whole file, so only quote the start of it
+        str = str.substr(0, std::min(str.find_first_of("\r\n"), size_t(32)));
+        throw std::runtime_error(std::format("Failed to parse string as number: '{}'", str));
+    }
+
+    /**
+     * Counts the leading decimal digits of the eight bytes at p, up to eight, and returns their
+     * value in digits. Subtracting '0' from every byte leaves digits as 0-9 and sets the top
+     * bit of the first byte that is not a digit; the digits are then combined pairwise in three
+     * multiplications.
+     */
+    inline size_t eightDigits(const char *p, uint64_t &digits) noexcept {
+        uint64_t word;
+        std::memcpy(&word, p, 8);
+        auto values = word - 0x3030303030303030ULL;
+        auto nonDigits = (values | (values + 0x7676767676767676ULL)) & 0x8080808080808080ULL;
+        size_t length = nonDigits == 0 ? 8 : std::countr_zero(nonDigits) / 8;
+        if (length == 0) {
+            return 0;
+        }
+        // Line the digits up at the top of the word so the low bytes become leading zeros
+        values <<= 8 * (8 - length);
+        values = ((values & 0x0f0f0f0f0f0f0f0fULL) * 2561) >> 8;
+        values = ((values & 0x00ff00ff00ff00ffULL) * 6553601) >> 16;
+        digits = ((values & 0x0000ffff0000ffffULL) * 42949672960001ULL) >> 32;
+        return length;
+    }
+}
+
+/**
+ * Parses the integer at the start of str with std::from_chars. Parsing stops at the first
+ * character that cannot be part of the number, like strtol, but nothing beyond str is read,
+ * so it is safe on substrings. Throws if there is no number or it does not fit in T.
+ */
+template <std::integral T>
+ParseResult<T> parseInteger(std::string_view str) {
+    T value{};
+    auto [end, error] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (error != std::errc{}) {
+        detail::failedToParse(str);
+    }
+    return {value, size_t(end - str.data())};
+}
+
+/**
+ * As parseInteger, but numbers of up to seven digits with at least eight readable bytes
+ * behind them are decoded eight bytes at a time without a loop. Anything else falls back
+ * to std::from_chars. Whether that beats parseInteger depends on the machine and on how
+ * short the numbers are, and longer ones are slower, so only callers that have measured a
+ * win with bench number, like day18's ingest, use it.
+ */
+template <std::integral T>
+ParseResult<T> parseIntegerSwar(std::string_view str) {
+    if constexpr (std::endian::native == std::endian::little) {
+        size_t sign = std::is_signed_v<T> && !str.empty() && str[0] == '-';
+        uint64_t digits;
+        size_t length;
+        if (str.size() >= sign + 8 && (length = detail::eightDigits(str.data() + sign, digits)) > 0 && length < 8) {
+            // Seven digits always fit in 32 bits, so only 8 and 16 bit types can overflow
+            if (sizeof(T) >= 4 || digits <= uint64_t(std::numeric_limits<T>::max()) + sign) {
+                auto value = sign ? T(0 - digits) : T(digits);
+                return {value, sign + length};
+            }
+        }
+    }
+    return parseInteger<T>(str);
+}
+
+/**
+ * Parses the integer at the start of str with parseInteger, discarding how much of it was
+ * consumed.
+ */
+template <std::integral T>
+T parseNumber(std::string_view str) {
+    return parseInteger<T>(str).value;
+}
+
+}
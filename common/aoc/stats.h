@@ -0,0 +1,109 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+/**
+ * Phase timers and event counters for the hot paths, reported with --stats.
+ *
+ *   AOC_PHASE("parse");                  // times the rest of the enclosing scope
+ *   AOC_COUNT("states expanded", n);     // adds n to a named counter
+ *
+ * Nothing is recorded until enable() is called, and then only a relaxed atomic add per
+ * count, so counts belong outside the innermost loops where that is easy. Building with
+ * AOC_STATS=0 compiles both macros, and the evaluation of their arguments, out entirely.
+ */
+
+#ifndef AOC_STATS
+#define AOC_STATS 1
+#endif
+
+namespace aoc::stats {
+
+namespace detail {
+    inline std::atomic<bool> enabled{false};
+}
+
+[[nodiscard]] inline bool enabled() noexcept { return detail::enabled.load(std::memory_order_relaxed); }
+
+void enable() noexcept;
+
+/**
+ * A named total, registered on construction. Names must outlive the program, which string
+ * literals do.
+ */
+class Counter {
+    std::string_view name;
+    std::atomic<uint64_t> value{0};
+
+    friend void report(std::ostream &out);
+    friend std::string reportJson();
+
+public:
+    explicit Counter(std::string_view name);
+
+    void add(uint64_t n) noexcept {
+        if (enabled()) {
+            value.fetch_add(n, std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * Adds the wall clock time from its construction to its destruction to the total for its
+ * name. Phases may nest, and are reported indented under the phase they started in. A phase
+ * still open when a report clears the totals is counted in the next report instead.
+ */
+class Phase {
+    std::string_view name;
+    // Nesting depth, or -1 if stats were not enabled when it started
+    int level = -1;
+    int64_t start = 0;
+
+public:
+    explicit Phase(std::string_view name);
+    ~Phase();
+
+    Phase(const Phase &) = delete;
+    Phase &operator=(const Phase &) = delete;
+};
+
+// Writes every phase and non-zero counter recorded since the last report, then clears them
+void report(std::ostream &out);
+
+// As report, but as a JSON object of phases and counters, for --format=json
+std::string reportJson();
+
+}
+
+#if AOC_STATS
+#define AOC_STATS_CONCAT_(a, b) a##b
+#define AOC_STATS_CONCAT(a, b) AOC_STATS_CONCAT_(a, b)
+#define AOC_PHASE(name) ::aoc::stats::Phase AOC_STATS_CONCAT(aocPhase, __LINE__)(name)
+#define AOC_COUNT(name, n)                                  \
+    do {                                                    \
+        static ::aoc::stats::Counter aocCounter(name);      \
+        aocCounter.add(n);                                  \
+    } while (false)
+#else
+#define AOC_PHASE(name) static_cast<void>(0)
+#define AOC_COUNT(name, n) static_cast<void>(0)
+#endif
@@ -0,0 +1,183 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "aoc/batch.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#include "aoc/cpu.h"
+#include "aoc/input.h"
+#include "aoc/number.h"
+#include "aoc/stats.h"
+
+namespace aoc {
+
+namespace {
+    bool isSpace(char c) {
+        return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
+}
+
+std::vector<std::string> expandArguments(int argc, char **argv) {
+    std::vector<std::string> arguments;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (!arg.starts_with('@')) {
+            arguments.emplace_back(arg);
+            continue;
+        }
+        InputFile manifest(std::string(arg.substr(1)));
+        for (auto line: manifest.lines()) {
+            if (line.starts_with('#')) {
+                continue;
+            }
+            auto it = line.begin();
+            while ((it = std::find_if_not(it, line.end(), isSpace)) != line.end()) {
+                auto last = std::find_if(it, line.end(), isSpace);
+                arguments.emplace_back(it, last);
+                it = last;
+            }
+        }
+    }
+    return arguments;
+}
+
+size_t parseJobs(std::string_view value) {
+    auto jobs = parseNumber<size_t>(value);
+    return jobs > 0 ? jobs : std::max(1u, std::thread::hardware_concurrency());
+}
+
+bool parseCommonOption(std::string_view arg, Batch &batch) {
+    if (arg == "--stats") {
+        stats::enable();
+    } else if (arg.starts_with("--isa=")) {
+        cpu::select(cpu::parseIsa(arg.substr(6)));
+    } else if (arg.starts_with("--jobs=")) {
+        batch.setJobs(parseJobs(arg.substr(7)));
+    } else if (arg.starts_with("--format=")) {
+        batch.setFormat(parseFormat(arg.substr(9)));
+    } else if (arg.starts_with("--")) {
+        throw std::runtime_error(std::format("Unknown option {}", arg));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void Batch::setJobs(size_t jobs) {
+    if (added > 0) {
+        throw std::runtime_error("--jobs must come before the first input");
+    }
+    jobCount = std::max<size_t>(1, jobs);
+}
+
+void Batch::setFormat(Format format) {
+    if (added > 0) {
+        throw std::runtime_error("--format must come before the first input");
+    }
+    outputFormat = format;
+}
+
+void Batch::add(std::string input, std::function<std::string()> run) {
+    size_t index = added++;
+    {
+        std::lock_guard lock(mutex);
+        pending.emplace_back();
+    }
+    auto task = [this, index, input = std::move(input), run = std::move(run)] {
+        Slot slot;
+        auto start = std::chrono::steady_clock::now();
+        try {
+            slot.text = run();
+        } catch (const std::exception &ex) {
+            slot.failed = true;
+            slot.text = ex.what();
+        }
+        if (outputFormat == Format::Json) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            JsonObject object;
+            object.add("input", input);
+            if (slot.failed) {
+                object.add("error", slot.text);
+            } else {
+                object.addRaw("answers", slot.text);
+            }
+            object.add("seconds", elapsed.count());
+            // Runs one at a time have the stats to themselves
+            if (jobCount == 1 && stats::enabled()) {
+                object.addRaw("stats", stats::reportJson());
+            }
+            slot.text = object.str() + "\n";
+        }
+        complete(index, std::move(slot));
+    };
+
+    if (jobCount == 1) {
+        task();
+        return;
+    }
+    if (!pool) {
+        pool.emplace(jobCount);
+    }
+    pool->submit(std::move(task));
+}
+
+void Batch::complete(size_t index, Slot slot) {
+    std::lock_guard lock(mutex);
+    slot.done = true;
+    pending[index - printed] = std::move(slot);
+
+    // Print whatever is now ready in order, which may be runs that finished before this one
+    while (!pending.empty() && pending.front().done) {
+        auto &next = pending.front();
+        if (next.failed) {
+            failures++;
+        }
+        // A JSON line carries its own error and stats
+        if (outputFormat == Format::Json) {
+            std::cout << next.text << std::flush;
+        } else if (next.failed) {
+            std::cout << std::flush;
+            std::cerr << "ERROR: " << next.text << std::endl;
+        } else {
+            std::cout << next.text << std::flush;
+        }
+        if (outputFormat == Format::Text && jobCount == 1 && stats::enabled()) {
+            stats::report(std::cerr);
+        }
+        pending.pop_front();
+        printed++;
+    }
+}
+
+int Batch::finish() {
+    pool.reset();
+    if (jobCount > 1 && stats::enabled()) {
+        if (outputFormat == Format::Json) {
+            std::cout << JsonObject().addRaw("stats", stats::reportJson()).str() << std::endl;
+        } else {
+            stats::report(std::cerr);
+        }
+    }
+    return failures > 0 ? 1 : 0;
+}
+
+}
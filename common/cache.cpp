@@ -0,0 +1,128 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "aoc/cache.h"
+
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+#include <unistd.h>
+
+#include "aoc/hash.h"
+#include "aoc/input.h"
+
+namespace aoc {
+
+namespace {
+    // Unrelated to the key hashes that seed the file names, so the two hashes collide independently
+    constexpr uint64_t DigestSeed = 0x9e3779b97f4a7c15;
+
+    std::string header(std::string_view key, std::string_view input, size_t valueSize) {
+        return std::format("AOCCACHE3 {} {:016x} {} {}\n", input.size(), hashBytes(input, DigestSeed),
+                           valueSize, key);
+    }
+}
+
+DiskCache::DiskCache(std::filesystem::path path) : directory(std::move(path)) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        throw std::runtime_error(std::format("Failed to create cache directory {}: {}",
+                                             directory.string(), error.message()));
+    }
+}
+
+std::filesystem::path DiskCache::defaultDirectory() {
+    if (const auto *dir = std::getenv("AOC_CACHE_DIR"); dir && *dir) {
+        return dir;
+    }
+    if (const auto *dir = std::getenv("XDG_CACHE_HOME"); dir && *dir) {
+        return std::filesystem::path(dir) / "aoc";
+    }
+    if (const auto *home = std::getenv("HOME"); home && *home) {
+        return std::filesystem::path(home) / ".cache" / "aoc";
+    }
+    throw std::runtime_error("No cache directory: set AOC_CACHE_DIR or HOME");
+}
+
+std::filesystem::path DiskCache::pathOf(std::string_view kind, std::string_view key, std::string_view input) const {
+    return directory / std::format("{}-{:016x}", kind, hashBytes(input, hashBytes(key)));
+}
+
+std::optional<std::string> DiskCache::load(std::string_view kind, std::string_view key,
+                                           std::string_view input) const {
+    auto path = pathOf(kind, key, input);
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error)) {
+        return std::nullopt;
+    }
+    // An entry that cannot be read is a miss, like one that is not there
+    std::optional<InputFile> file;
+    try {
+        file.emplace(path.string());
+    } catch (const std::exception &) {
+        return std::nullopt;
+    }
+    auto contents = file->contents();
+    auto newline = contents.find('\n');
+    if (newline == std::string_view::npos) {
+        return std::nullopt;
+    }
+    auto value = contents.substr(newline + 1);
+    if (contents.substr(0, newline + 1) != header(key, input, value.size())) {
+        return std::nullopt;
+    }
+    return std::string(value);
+}
+
+void DiskCache::store(std::string_view kind, std::string_view key, std::string_view input,
+                      std::string_view value) const {
+    auto path = pathOf(kind, key, input);
+    auto temporary = path;
+    temporary += std::format(".{}.{}", ::getpid(), std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    std::error_code error;
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        auto head = header(key, input, value.size());
+        out.write(head.data(), std::streamsize(head.size()));
+        out.write(value.data(), std::streamsize(value.size()));
+        out.close();
+        if (!out) {
+            std::filesystem::remove(temporary, error);
+            throw std::runtime_error(std::format("Failed to write cache entry {}", temporary.string()));
+        }
+    }
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        std::filesystem::remove(temporary, error);
+        throw std::runtime_error(std::format("Failed to write cache entry {}", path.string()));
+    }
+}
+
+void DiskCache::storeOrWarn(std::string_view kind, std::string_view key, std::string_view input,
+                            std::string_view value) const noexcept {
+    try {
+        store(kind, key, input, value);
+    } catch (const std::exception &ex) {
+        std::cerr << "WARNING: " << ex.what() << std::endl;
+    }
+}
+
+}
@@ -0,0 +1,105 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "aoc/cpu.h"
+
+#include <algorithm>
+#include <format>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace aoc::cpu {
+
+namespace {
+    constexpr std::array<std::string_view, IsaCount> Names{"scalar", "sse4.2", "avx2", "avx512"};
+
+    // No cap until select() is called, so kernels choose the best the CPU has
+    std::atomic<Isa> cap{Isa::Avx512};
+
+    struct Registry {
+        std::mutex mutex;
+        std::vector<detail::KernelBase *> kernels;
+    };
+
+    // Kernels are constructed during static initialisation, in no particular order
+    Registry &registry() {
+        static Registry instance;
+        return instance;
+    }
+
+    Isa detect() noexcept {
+#if AOC_X86
+        // These also check that the operating system saves the wider registers
+        __builtin_cpu_init();
+        bool sse42 = __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+        bool avx2 = sse42 && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2")
+                && __builtin_cpu_supports("fma");
+        bool avx512 = avx2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+                && __builtin_cpu_supports("avx512vl");
+        if (avx512) {
+            return Isa::Avx512;
+        } else if (avx2) {
+            return Isa::Avx2;
+        } else if (sse42) {
+            return Isa::Sse42;
+        }
+#endif
+        return Isa::Scalar;
+    }
+}
+
+std::string_view name(Isa isa) noexcept {
+    return Names[size_t(isa)];
+}
+
+Isa parseIsa(std::string_view name) {
+    for (size_t i = 0; i < IsaCount; i++) {
+        if (Names[i] == name) {
+            return Isa(i);
+        }
+    }
+    throw std::runtime_error(std::format("Unknown instruction set '{}', expected scalar, sse4.2, avx2 or avx512", name));
+}
+
+Isa detected() noexcept {
+    static const Isa isa = detect();
+    return isa;
+}
+
+Isa selected() noexcept {
+    return std::min(detected(), cap.load(std::memory_order_relaxed));
+}
+
+void select(Isa isa) {
+    if (isa > detected()) {
+        throw std::runtime_error(std::format("This CPU supports up to {}, not {}", name(detected()), name(isa)));
+    }
+    auto &r = registry();
+    std::lock_guard lock(r.mutex);
+    cap.store(isa, std::memory_order_relaxed);
+    for (auto *kernel: r.kernels) {
+        kernel->choose(isa);
+    }
+}
+
+void detail::add(KernelBase *kernel) {
+    auto &r = registry();
+    std::lock_guard lock(r.mutex);
+    r.kernels.push_back(kernel);
+    kernel->choose(selected());
+}
+
+}
@@ -0,0 +1,105 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "aoc/hash.h"
+
+#include <bit>
+#include <cstring>
+
+namespace aoc {
+
+namespace {
+    constexpr uint64_t Prime1 = 0x9e3779b185ebca87ULL;
+    constexpr uint64_t Prime2 = 0xc2b2ae3d27d4eb4fULL;
+    constexpr uint64_t Prime3 = 0x165667b19e3779f9ULL;
+    constexpr uint64_t Prime4 = 0x85ebca77c2b2ae63ULL;
+    constexpr uint64_t Prime5 = 0x27d4eb2f165667c5ULL;
+
+    // XXH64 is defined on little endian words
+    template <typename T>
+    T read(const char *p) noexcept {
+        T value;
+        std::memcpy(&value, p, sizeof(T));
+        if constexpr (std::endian::native == std::endian::big) {
+            T swapped = 0;
+            for (size_t i = 0; i < sizeof(T); i++) {
+                swapped = (swapped << 8) | ((value >> (8 * i)) & 0xff);
+            }
+            value = swapped;
+        }
+        return value;
+    }
+
+    uint64_t round(uint64_t acc, uint64_t input) noexcept {
+        acc += input * Prime2;
+        return std::rotl(acc, 31) * Prime1;
+    }
+
+    uint64_t mergeRound(uint64_t acc, uint64_t value) noexcept {
+        acc ^= round(0, value);
+        return acc * Prime1 + Prime4;
+    }
+}
+
+uint64_t hashBytes(std::string_view bytes, uint64_t seed) noexcept {
+    auto p = bytes.data();
+    auto end = p + bytes.size();
+    uint64_t h;
+
+    if (bytes.size() >= 32) {
+        // Four independent lanes over 32 byte stripes
+        uint64_t v1 = seed + Prime1 + Prime2;
+        uint64_t v2 = seed + Prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - Prime1;
+        for (; end - p >= 32; p += 32) {
+            v1 = round(v1, read<uint64_t>(p));
+            v2 = round(v2, read<uint64_t>(p + 8));
+            v3 = round(v3, read<uint64_t>(p + 16));
+            v4 = round(v4, read<uint64_t>(p + 24));
+        }
+        h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    } else {
+        h = seed + Prime5;
+    }
+    h += bytes.size();
+
+    for (; end - p >= 8; p += 8) {
+        h ^= round(0, read<uint64_t>(p));
+        h = std::rotl(h, 27) * Prime1 + Prime4;
+    }
+    if (end - p >= 4) {
+        h ^= uint64_t(read<uint32_t>(p)) * Prime1;
+        h = std::rotl(h, 23) * Prime2 + Prime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= uint64_t(static_cast<unsigned char>(*p)) * Prime5;
+        h = std::rotl(h, 11) * Prime1;
+    }
+
+    h ^= h >> 33;
+    h *= Prime2;
+    h ^= h >> 29;
+    h *= Prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+}
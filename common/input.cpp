@@ -0,0 +1,191 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "aoc/input.h"
+
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+#include "aoc/cpu.h"
+
+#if __has_include(<sys/mman.h>)
+#define AOC_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define AOC_HAVE_MMAP 0
+#endif
+
+#if AOC_X86
+#include <immintrin.h>
+#endif
+
+namespace aoc {
+
+namespace {
+    const char *findNewlineScalar(const char *begin, const char *end) noexcept {
+        auto found = static_cast<const char *>(std::memchr(begin, '\n', end - begin));
+        return found ? found : end;
+    }
+
+#if AOC_X86
+    AOC_TARGET("sse4.2")
+    const char *findNewlineSse42(const char *begin, const char *end) noexcept {
+        auto p = begin;
+        const auto newlines = _mm_set1_epi8('\n');
+        for (; end - p >= 16; p += 16) {
+            auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+            auto mask = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newlines)));
+            if (mask != 0) {
+                return p + __builtin_ctz(mask);
+            }
+        }
+        return findNewlineScalar(p, end);
+    }
+
+    AOC_TARGET("avx2")
+    const char *findNewlineAvx2(const char *begin, const char *end) noexcept {
+        auto p = begin;
+        const auto newlines = _mm256_set1_epi8('\n');
+        for (; end - p >= 32; p += 32) {
+            auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+            auto mask = unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newlines)));
+            if (mask != 0) {
+                return p + __builtin_ctz(mask);
+            }
+        }
+        return findNewlineScalar(p, end);
+    }
+
+    AOC_TARGET("avx512f,avx512bw")
+    const char *findNewlineAvx512(const char *begin, const char *end) noexcept {
+        auto p = begin;
+        const auto newlines = _mm512_set1_epi8('\n');
+        for (; end - p >= 64; p += 64) {
+            auto block = _mm512_loadu_si512(p);
+            auto mask = _mm512_cmpeq_epi8_mask(block, newlines);
+            if (mask != 0) {
+                return p + __builtin_ctzll(mask);
+            }
+        }
+        return findNewlineScalar(p, end);
+    }
+
+    cpu::Kernel<decltype(&findNewlineScalar)> findNewlineKernel(
+            "findNewline", findNewlineScalar, findNewlineSse42, findNewlineAvx2, findNewlineAvx512);
+#else
+    cpu::Kernel<decltype(&findNewlineScalar)> findNewlineKernel("findNewline", findNewlineScalar);
+#endif
+}
+
+const char *findNewline(const char *begin, const char *end) noexcept {
+    return findNewlineKernel(begin, end);
+}
+
+void Lines::iterator::advance() noexcept {
+    if (next == end) {
+        done = true;
+        return;
+    }
+    auto newline = findNewline(next, end);
+    auto length = size_t(newline - next);
+    if (length > 0 && next[length - 1] == '\r') {
+        length--;
+    }
+    line = std::string_view(next, length);
+    next = newline == end ? end : newline + 1;
+}
+
+void Records::iterator::advance() noexcept {
+    const Lines::iterator last;
+    while (line != last && line->empty()) {
+        ++line;
+    }
+    if (line == last) {
+        done = true;
+        return;
+    }
+    auto start = line->data();
+    auto finish = start;
+    for (; line != last && !line->empty(); ++line) {
+        finish = line->data() + line->size();
+    }
+    record = std::string_view(start, finish - start);
+}
+
+InputFile::InputFile(const std::string &path) {
+    if (path == "-") {
+        buffer.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+        view = buffer;
+        return;
+    }
+
+#if AOC_HAVE_MMAP
+    auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error(std::format("Failed to open file {}", path));
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+        if (info.st_size > 0) {
+            auto *data = ::mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                ::madvise(data, size_t(info.st_size), MADV_SEQUENTIAL);
+                mapping = data;
+                view = {static_cast<const char *>(data), size_t(info.st_size)};
+                ::close(fd);
+                return;
+            }
+        } else {
+            ::close(fd);
+            return;
+        }
+    }
+
+    // Pipes and the like cannot be mapped, so read them to the end
+    char chunk[1 << 16];
+    ssize_t count;
+    while ((count = ::read(fd, chunk, sizeof(chunk))) > 0) {
+        buffer.append(chunk, size_t(count));
+    }
+    ::close(fd);
+    if (count < 0) {
+        throw std::runtime_error(std::format("Failed to read file {}", path));
+    }
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error(std::format("Failed to open file {}", path));
+    }
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+#endif
+    view = buffer;
+}
+
+InputFile::~InputFile() {
+#if AOC_HAVE_MMAP
+    if (mapping) {
+        ::munmap(mapping, view.size());
+    }
+#endif
+}
+
+}
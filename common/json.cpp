@@ -0,0 +1,93 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "aoc/json.h"
+
+#include <cmath>
+#include <format>
+#include <stdexcept>
+
+namespace aoc {
+
+Format parseFormat(std::string_view value) {
+    if (value == "text") {
+        return Format::Text;
+    } else if (value == "json") {
+        return Format::Json;
+    }
+    throw std::runtime_error(std::format("Unknown output format '{}', expected text or json", value));
+}
+
+void appendJsonString(std::string &out, std::string_view value) {
+    out += '"';
+    for (char c: value) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += std::format("\\u{:04x}", int(c));
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+void JsonObject::key(std::string_view name) {
+    if (text.size() > 1) {
+        text += ',';
+    }
+    appendJsonString(text, name);
+    text += ':';
+}
+
+JsonObject &JsonObject::add(std::string_view name, std::string_view value) {
+    key(name);
+    appendJsonString(text, value);
+    return *this;
+}
+
+JsonObject &JsonObject::add(std::string_view name, bool value) {
+    return addRaw(name, value ? "true" : "false");
+}
+
+JsonObject &JsonObject::add(std::string_view name, double value) {
+    // JSON has no infinities or NaNs
+    return std::isfinite(value) ? addRaw(name, std::format("{}", value)) : addNull(name);
+}
+
+JsonObject &JsonObject::addRaw(std::string_view name, std::string_view json) {
+    key(name);
+    text += json;
+    return *this;
+}
+
+std::string jsonArray(const std::vector<std::string> &values) {
+    std::string text = "[";
+    for (const auto &value: values) {
+        if (text.size() > 1) {
+            text += ',';
+        }
+        text += value;
+    }
+    return text + "]";
+}
+
+}
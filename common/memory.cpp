@@ -0,0 +1,49 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "aoc/memory.h"
+
+#include <format>
+#include <stdexcept>
+
+namespace aoc {
+
+Allocator parseAllocator(std::string_view name) {
+    if (name == "default") {
+        return Allocator::Default;
+    } else if (name == "arena") {
+        return Allocator::Arena;
+    } else if (name == "pool") {
+        return Allocator::Pool;
+    }
+    throw std::runtime_error(std::format("Unknown allocator '{}', expected default, arena or pool", name));
+}
+
+RunMemory::RunMemory(Allocator allocator) {
+    // Arena blocks start at this size and grow geometrically, so even large runs take few of them
+    constexpr size_t InitialArena = 1 << 16;
+
+    if (allocator == Allocator::Default) {
+        return;
+    }
+    arena.emplace(InitialArena, std::pmr::new_delete_resource());
+    memory = &*arena;
+    if (allocator == Allocator::Pool) {
+        pool.emplace(&*arena);
+        memory = &*pool;
+    }
+}
+
+}
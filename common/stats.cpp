@@ -0,0 +1,148 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "aoc/stats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "aoc/json.h"
+
+namespace aoc::stats {
+
+namespace {
+    struct PhaseTotal {
+        std::string_view name;
+        int depth = 0;
+        int64_t nanoseconds = 0;
+        uint64_t calls = 0;
+    };
+
+    // Phases are coarse, so one lock around all of them costs nothing worth measuring
+    std::mutex mutex;
+    std::vector<PhaseTotal> phases;
+    std::vector<Counter *> counters;
+
+    thread_local int depth = 0;
+
+    // The total for name at the given depth, added if there is none yet; call with mutex held
+    PhaseTotal &totalFor(std::string_view name, int level) {
+        // The same name at a different depth is a different phase, e.g. parse within preprocess
+        auto it = std::find_if(phases.begin(), phases.end(), [&](const PhaseTotal &phase) {
+            return phase.name == name && phase.depth == level;
+        });
+        if (it == phases.end()) {
+            it = phases.insert(phases.end(), PhaseTotal{name, level});
+        }
+        return *it;
+    }
+
+    int64_t now() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+void enable() noexcept {
+    detail::enabled.store(true, std::memory_order_relaxed);
+}
+
+Counter::Counter(std::string_view name) : name(name) {
+    std::lock_guard lock(mutex);
+    counters.push_back(this);
+}
+
+Phase::Phase(std::string_view name) : name(name) {
+    if (!enabled()) {
+        return;
+    }
+    {
+        // Registered now, so that it is reported before the phases nested in it
+        std::lock_guard lock(mutex);
+        totalFor(name, depth);
+    }
+    level = depth++;
+    start = now();
+}
+
+Phase::~Phase() {
+    if (level < 0) {
+        return;
+    }
+    auto elapsed = now() - start;
+    depth--;
+    std::lock_guard lock(mutex);
+    // Looked up again, as a report since construction may have cleared the totals
+    auto &total = totalFor(name, level);
+    total.nanoseconds += elapsed;
+    total.calls++;
+}
+
+void report(std::ostream &out) {
+    std::lock_guard lock(mutex);
+    out << "Stats:\n";
+#if !AOC_STATS
+    out << "  none, as this was built with AOC_STATS=0\n";
+#endif
+    for (const auto &phase: phases) {
+        auto label = std::string(size_t(2 * phase.depth), ' ') + std::string(phase.name);
+        out << std::format("  {:<28}{:>12.3f} ms", label, double(phase.nanoseconds) / 1e6);
+        if (phase.calls > 1) {
+            out << std::format(" over {} calls", phase.calls);
+        }
+        out << '\n';
+    }
+    for (auto *counter: counters) {
+        auto value = counter->value.exchange(0, std::memory_order_relaxed);
+        if (value > 0) {
+            out << std::format("  {:<28}{:>12}\n", counter->name, value);
+        }
+    }
+    out.flush();
+    phases.clear();
+}
+
+std::string reportJson() {
+    std::lock_guard lock(mutex);
+    std::vector<std::string> phaseValues;
+    for (const auto &phase: phases) {
+        phaseValues.push_back(JsonObject()
+                                      .add("name", phase.name)
+                                      .add("depth", phase.depth)
+                                      .add("ms", double(phase.nanoseconds) / 1e6)
+                                      .add("calls", phase.calls)
+                                      .str());
+    }
+    JsonObject counterValues;
+    for (auto *counter: counters) {
+        auto value = counter->value.exchange(0, std::memory_order_relaxed);
+        if (value > 0) {
+            counterValues.add(counter->name, value);
+        }
+    }
+    phases.clear();
+    return JsonObject()
+            .add("enabled", bool(AOC_STATS))
+            .addRaw("phases", jsonArray(phaseValues))
+            .addRaw("counters", counterValues.str())
+            .str();
+}
+
+}
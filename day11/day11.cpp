@@ -0,0 +1,180 @@
+//   Copyright 19/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "day11.h"
+
+#include <format>
+#include <algorithm>
+#include <numeric>
+
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/number.h"
+#include "aoc/stats.h"
+
+namespace day11 {
+
+void Monkey::runTurn(std::vector<Monkey>& monkeys, Number modulo, bool relaxing) {
+    std::vector<Number> mishandledItems;
+    mishandledItems.reserve(items.size());
+
+    std::transform(items.begin(), items.end(), std::back_inserter(mishandledItems),
+                   [this, relaxing, modulo](const Number& worryLevel) {
+        Number newWorryLevel = operation.evaluate(worryLevel) % modulo;
+        if (relaxing) {
+            newWorryLevel /= 3;
+        }
+        return newWorryLevel;
+    });
+    auto partitionPoint = std::partition(mishandledItems.begin(), mishandledItems.end(), [this](const Number& worryLevel) {
+        return worryLevel % divisor == 0;
+    });
+    size_t trueItems = 0;
+    size_t falseItems = 0;
+    for (auto it = mishandledItems.begin(); it != partitionPoint; it++) {
+        monkeys[trueTarget].items.push_back(*it);
+        trueItems++;
+    }
+    for (auto it = partitionPoint; it != mishandledItems.end(); it++) {
+        monkeys[falseTarget].items.push_back(*it);
+        falseItems++;
+    }
+    itemsHandled += items.size();
+    items.clear();
+}
+
+namespace {
+    std::vector<Number> parseItems(std::string_view description) {
+        std::vector<Number> items;
+
+        size_t start = 0;
+        size_t comma = description.find(", ");
+        while (true) {
+            auto n = description.substr(start, comma - start);
+            items.push_back(aoc::parseNumber<Number>(n));
+
+            start = comma;
+            if (start == std::string_view::npos) {
+                break;
+            }
+            start += 2;
+            comma = description.find(", ", start + 1);
+        }
+        return items;
+    }
+
+    Operation parseOperation(std::string_view description) {
+        auto space = description.find(' ');
+        std::string_view lhsString = description.substr(0, space);
+
+        auto start = space + 1;
+        space = description.find(' ', start + 1);
+        std::string_view operationString = description.substr(start, space - start);
+
+        start = space + 1;
+        space = description.find_first_of(" \r\n", start + 1);
+        std::string_view rhsString = description.substr(start, space - start);
+
+        Number lhs = 0;
+        Number rhs = 0;
+        if (lhsString != "old") {
+            lhs = aoc::parseNumber<Number>(lhsString);
+        }
+        if (rhsString != "old") {
+            rhs = aoc::parseNumber<Number>(rhsString);
+        }
+
+        if (operationString == "/") {
+            return Operation(ArithmeticOperation::Divide, lhs, rhs);
+        } else if (operationString == "*") {
+            return Operation(ArithmeticOperation::Multiply, lhs, rhs);
+        } else if (operationString == "+") {
+            return Operation(ArithmeticOperation::Add, lhs, rhs);
+        } else {
+            return Operation(ArithmeticOperation::Subtract, lhs, rhs);
+        }
+    }
+}
+
+std::vector<Monkey> parseMonkeys(std::string_view input) {
+    AOC_PHASE("parse");
+    std::vector<Monkey> monkeys;
+    for (auto record : aoc::Records(input)) {
+        auto line = aoc::Lines(record).begin();
+        auto nextLine = [&, last = aoc::Lines::iterator()]() {
+            if (++line == last) {
+                throw std::runtime_error(std::format("Incomplete monkey description: '{}'", record));
+            }
+            return *line;
+        };
+        // Skip over Monkey line
+
+        // Items line
+        auto items = parseItems(nextLine().substr(18));
+
+        // Operation line
+        auto operation = parseOperation(nextLine().substr(19));
+
+        // Test line
+        auto test = aoc::parseNumber<Number>(nextLine().substr(21));
+
+        // True target line
+        auto trueTarget = aoc::parseNumber<Number>(nextLine().substr(29));
+
+        // False target line
+        auto falseTarget = aoc::parseNumber<Number>(nextLine().substr(30));
+
+        monkeys.emplace_back(std::move(items), operation, test, trueTarget, falseTarget);
+    }
+
+    return monkeys;
+}
+
+size_t monkeyBusiness(std::vector<Monkey> monkeys, size_t iterations, bool relaxing) {
+    auto modulo = std::transform_reduce(monkeys.begin(), monkeys.end(), Number(1), std::multiplies(), [](const Monkey& monkey) {
+        return monkey.divisor;
+    });
+    for (size_t i = 0; i < iterations; i++) {
+        for (auto& monkey : monkeys) {
+            monkey.runTurn(monkeys, modulo, relaxing);
+        }
+    }
+
+    AOC_COUNT("items inspected", std::transform_reduce(monkeys.begin(), monkeys.end(), size_t(0), std::plus(),
+                                                        [](const Monkey& monkey) { return monkey.itemsHandled; }));
+    std::sort(monkeys.begin(), monkeys.end(), [](const Monkey& a, const Monkey& b) {
+        return a.itemsHandled > b.itemsHandled;
+    });
+    return monkeys[0].itemsHandled * monkeys[1].itemsHandled;
+}
+
+Result solve(const std::vector<Monkey>& monkeys) {
+    AOC_PHASE("solve");
+    return {monkeyBusiness(monkeys, 20, true), monkeyBusiness(monkeys, 10000, false)};
+}
+
+Result solve(std::string_view input) {
+    return solve(parseMonkeys(input));
+}
+
+std::string report(const Result& result) {
+    return std::format("Part 1: {}\nPart 2: {}\n", result.part1, result.part2);
+}
+
+std::string toJson(const Result& result) {
+    return aoc::JsonObject().add("part1", result.part1).add("part2", result.part2).str();
+}
+
+}
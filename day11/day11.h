@@ -0,0 +1,96 @@
+//   Copyright 19/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace day11 {
+
+enum class ArithmeticOperation : uint8_t {
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+};
+
+using Number = uint64_t;
+
+struct Operation {
+    ArithmeticOperation operation;
+    Number lhs;
+    Number rhs;
+
+    explicit Operation(ArithmeticOperation op, Number l, Number r)
+    : operation(op), lhs(std::move(l)), rhs(std::move(r))
+    {}
+
+    [[nodiscard]] Number evaluate(const Number& old) const {
+        const auto& l = (lhs == 0) ? old : lhs;
+        const auto& r = (rhs == 0) ? old : rhs;
+
+        switch (operation) {
+            case ArithmeticOperation::Add: return l + r;
+            case ArithmeticOperation::Subtract: return l - r;
+            case ArithmeticOperation::Multiply: return l * r;
+            case ArithmeticOperation::Divide: return l / r;
+        }
+        throw std::runtime_error("Unreachable condition");
+    }
+};
+
+struct Monkey {
+    std::vector<Number> items;
+    Operation operation;
+    size_t divisor;
+    size_t trueTarget;
+    size_t falseTarget;
+    size_t itemsHandled = 0;
+
+    Monkey(std::vector<Number> items, Operation operation, size_t divisor, size_t trueTarget,
+           size_t falseTarget) : items(std::move(items)), operation(operation), divisor(divisor), trueTarget(trueTarget),
+                                 falseTarget(falseTarget) {}
+
+    void runTurn(std::vector<Monkey>& monkeys, Number modulo, bool relaxing);
+};
+
+std::vector<Monkey> parseMonkeys(std::string_view input);
+
+/**
+ * Plays the given number of rounds and multiplies together the number of items handled by the
+ * two busiest monkeys. Relaxing divides each worry level by three after inspection.
+ */
+size_t monkeyBusiness(std::vector<Monkey> monkeys, size_t iterations, bool relaxing);
+
+struct Result {
+    size_t part1 = 0;
+    size_t part2 = 0;
+};
+
+Result solve(const std::vector<Monkey>& monkeys);
+Result solve(std::string_view input);
+
+// The lines the executable prints for a result
+std::string report(const Result& result);
+
+// The result as a JSON object for --format=json
+std::string toJson(const Result& result);
+
+}
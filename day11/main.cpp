@@ -0,0 +1,45 @@
+//   Copyright 19/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include <format>
+#include <iostream>
+#include <string>
+
+#include "day11.h"
+#include "aoc/batch.h"
+#include "aoc/input.h"
+#include "aoc/json.h"
+
+int main(int argc, char** argv)
+try {
+    aoc::Batch batch;
+    for (const auto &arg: aoc::expandArguments(argc, argv)) {
+        if (!aoc::parseCommonOption(arg, batch)) {
+            batch.add(arg, [arg, format = batch.format()] {
+                aoc::InputFile file(arg);
+                auto result = day11::solve(file.contents());
+                return format == aoc::Format::Json ? day11::toJson(result) : day11::report(result);
+            });
+        }
+    }
+    if (batch.size() == 0) {
+        std::cerr << "No input file specified" << std::endl;
+        return 1;
+    }
+    return batch.finish();
+} catch (const std::exception& ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
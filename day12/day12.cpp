@@ -13,43 +13,27 @@
 //   limitations under the License.
 //
 
-#include <fstream>
-#include <iostream>
-#include <cstdint>
-#include <map>
-#include <string>
+#include "day12.h"
+
+#include <format>
 #include <set>
+#include <stdexcept>
 #include <algorithm>
 #include <vector>
-#include <bitset>
-
-using Point = std::tuple<uint64_t, uint64_t>;
-using HeightMap = std::map<Point, char>;
 
-struct Mountain {
-    const std::map<Point, char> vertices;
-    const std::map<Point, std::bitset<4>> edges;
-    std::map<Point, uint64_t> distances;
-    Point start;
-    Point end;
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/stats.h"
 
-    explicit Mountain(const char* filename);
+namespace day12 {
 
-private:
-    void calculateDistancesToEnd();
-};
-
-std::map<Point, char> parseVertices(const char* fileName) {
-    std::map<Point, char> vertices;
-    std::ifstream file(fileName);
-    if (!file) {
-        throw std::runtime_error(std::string("Failed to open file: ") + fileName);
-    }
-    std::string line;
+HeightMap parseVertices(std::string_view input, std::pmr::memory_resource *memory) {
+    AOC_PHASE("parse");
+    HeightMap vertices(memory);
 
     uint64_t height = 0;
     uint64_t width;
-    while (std::getline(file, line)) {
+    for (auto line : aoc::Lines(input)) {
         width = 0;
         for (char c: line) {
             vertices.emplace(Point{width, height}, c);
@@ -66,15 +50,16 @@ char clampHeight(char h) {
     return h;
 }
 
-std::map<Point, std::bitset<4>> computeEdges(const std::map<Point, char>& vertices) {
-    auto testEdge = [vertices](char myHeight, const Point& p) {
+std::pmr::map<Point, std::bitset<4>> computeEdges(const HeightMap& vertices) {
+    AOC_PHASE("preprocess");
+    auto testEdge = [&vertices](char myHeight, const Point& p) {
         auto it = vertices.find(p);
         if (it == vertices.end())
             return false;
         auto neighbourHeight = clampHeight(it->second);
         return neighbourHeight + 1 >= myHeight;
     };
-    std::map<Point, std::bitset<4>> edges;
+    std::pmr::map<Point, std::bitset<4>> edges(vertices.get_allocator());
 
     for (const auto& [p, h] : vertices) {
         auto [x, y] = p;
@@ -89,9 +74,10 @@ std::map<Point, std::bitset<4>> computeEdges(const std::map<Point, char>& vertic
     return edges;
 }
 
-Mountain::Mountain(const char* fileName)
-: vertices(parseVertices(fileName))
+Mountain::Mountain(std::string_view input, std::pmr::memory_resource *memory)
+: vertices(parseVertices(input, memory))
 , edges(computeEdges(vertices))
+, distances(memory)
 {
     for (const auto& [p, h] : vertices) {
         if (h == 'S') {
@@ -105,7 +91,8 @@ Mountain::Mountain(const char* fileName)
 }
 
 void Mountain::calculateDistancesToEnd() {
-    std::set<Point> Q;
+    AOC_PHASE("solve");
+    std::pmr::set<Point> Q(distances.get_allocator());
 
     // For each vertex v
     //  * set distance[v] to zero
@@ -127,6 +114,7 @@ void Mountain::calculateDistancesToEnd() {
             return distances[p1] < distances[p2];
         });
         Q.erase(point);
+        AOC_COUNT("vertices settled", 1);
 
         auto [x, y] = point;
         auto distance = distances[point];
@@ -150,15 +138,12 @@ void Mountain::calculateDistancesToEnd() {
     }
 }
 
-int main(int argc, char** argv)
-try {
-    if (argc < 2) {
-        std::cerr << "No input file specified" << std::endl;
-        return 1;
+Result solve(const Mountain& mountain) {
+    // Squares that cannot reach the end are left at UINT64_MAX
+    auto part1 = mountain.distances.at(mountain.start);
+    if (part1 == UINT64_MAX) {
+        throw std::runtime_error("The start cannot reach the end");
     }
-    Mountain mountain(argv[1]);
-    auto part1 = mountain.distances[mountain.start];
-    std::cout << "Part 1: " << part1 << std::endl;
 
     auto part2 = part1;
     for (const auto& [point, distance] : mountain.distances) {
@@ -166,9 +151,19 @@ try {
             part2 = distance;
         }
     }
-    std::cout << "Part 2: " << part2 << std::endl;
-    return 0;
-} catch (const std::exception& ex) {
-    std::cerr << "ERROR: " << ex.what() << std::endl;
-    return 1;
-}
\ No newline at end of file
+    return {part1, part2};
+}
+
+Result solve(std::string_view input, std::pmr::memory_resource *memory) {
+    return solve(Mountain(input, memory));
+}
+
+std::string report(const Result& result) {
+    return std::format("Part 1: {}\nPart 2: {}\n", result.part1, result.part2);
+}
+
+std::string toJson(const Result& result) {
+    return aoc::JsonObject().add("part1", result.part1).add("part2", result.part2).str();
+}
+
+}
@@ -0,0 +1,65 @@
+//   Copyright 18/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+namespace day12 {
+
+using Point = std::tuple<uint64_t, uint64_t>;
+using HeightMap = std::pmr::map<Point, char>;
+
+// Every map of a mountain allocates from the memory resource it is built with
+struct Mountain {
+    const std::pmr::map<Point, char> vertices;
+    const std::pmr::map<Point, std::bitset<4>> edges;
+    std::pmr::map<Point, uint64_t> distances;
+    Point start;
+    Point end;
+
+    explicit Mountain(std::string_view input, std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+private:
+    void calculateDistancesToEnd();
+};
+
+HeightMap parseVertices(std::string_view input, std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+// S and E stand for the lowest and highest ground
+char clampHeight(char h);
+
+struct Result {
+    uint64_t part1 = 0;
+    uint64_t part2 = 0;
+};
+
+// Throws if the start cannot reach the end
+Result solve(const Mountain& mountain);
+Result solve(std::string_view input, std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+// The lines the executable prints for a result
+std::string report(const Result& result);
+
+// The result as a JSON object for --format=json
+std::string toJson(const Result& result);
+
+}
@@ -0,0 +1,157 @@
+//   Copyright 20/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "day13.h"
+
+#include <algorithm>
+#include <format>
+
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/stats.h"
+
+namespace day13 {
+
+namespace {
+    /**
+     * Boost.JSON has a memory_resource base class of its own, so this lets it allocate from a
+     * standard one.
+     */
+    class StandardResource final : public boost::json::memory_resource {
+        std::pmr::memory_resource *upstream;
+
+        void *do_allocate(size_t bytes, size_t alignment) override {
+            return upstream->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *p, size_t bytes, size_t alignment) override {
+            upstream->deallocate(p, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const boost::json::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+
+    public:
+        explicit StandardResource(std::pmr::memory_resource *upstream) : upstream(upstream) {}
+    };
+}
+
+PacketPairs parseInput(std::string_view input, std::pmr::memory_resource *memory) {
+    AOC_PHASE("parse");
+    boost::json::storage_ptr storage;
+    if (memory != std::pmr::get_default_resource()) {
+        storage = boost::json::make_shared_resource<StandardResource>(memory);
+    }
+    PacketPairs packetPairs;
+    for (auto record : aoc::Records(input)) {
+        auto lines = aoc::Lines(record);
+        auto line = lines.begin();
+        auto p1 = boost::json::parse(*line, storage);
+
+        if (++line == lines.end()) {
+            throw std::runtime_error(std::format("Packet pair is missing its second packet: '{}'", record));
+        }
+        auto p2 = boost::json::parse(*line, storage);
+
+        packetPairs.emplace_back(std::move(p1), std::move(p2));
+    }
+    return packetPairs;
+}
+
+std::strong_ordering operator<=>(const boost::json::value&, const boost::json::value&);
+
+std::strong_ordering operator<=>(const boost::json::array& first, const boost::json::array& second) {
+    for (size_t i = 0; i < std::min(first.size(), second.size()); i++) {
+        auto result = first[i] <=> second[i];
+        if (result != std::strong_ordering::equal)
+            return result;
+    }
+    return first.size() <=> second.size();
+}
+
+std::strong_ordering operator<=>(const boost::json::value& first, const boost::json::value& second) {
+    if (first.is_number() && second.is_number()) {
+        return first.as_int64() <=> second.as_int64();
+    }
+    if (first.is_number() && second.is_array()) {
+        boost::json::array tmp;
+        tmp.push_back(first);
+        return tmp <=> second.as_array();
+    }
+    if (first.is_array() && second.is_number()) {
+        boost::json::array tmp;
+        tmp.push_back(second);
+        return first.as_array() <=> tmp;
+    }
+    const auto& a1 = first.as_array();
+    const auto& a2 = second.as_array();
+    return a1 <=> a2;
+}
+
+size_t part1(const PacketPairs& packetPairs) {
+    size_t sum = 0;
+    size_t index = 1;
+    for (const auto& [first, second] : packetPairs) {
+        if (first < second) {
+            sum += index;
+        }
+        index++;
+    }
+    return sum;
+}
+
+size_t part2(const PacketPairs& packetPairs) {
+    boost::json::value two = boost::json::parse("[[2]]");
+    boost::json::value six = boost::json::parse("[[6]]");
+    std::vector<const boost::json::value*> packets;
+    for (const auto& [first, second] : packetPairs) {
+        packets.push_back(&first);
+        packets.push_back(&second);
+    }
+    packets.push_back(&two);
+    packets.push_back(&six);
+
+    size_t comparisons = 0;
+    std::sort(packets.begin(), packets.end(), [&comparisons](const boost::json::value* a, const boost::json::value* b) {
+        comparisons++;
+        return *a < *b;
+    });
+    AOC_COUNT("packet comparisons", comparisons);
+
+    auto twoIdx = std::find(packets.begin(), packets.end(), &two);
+    auto sixIdx = std::find(twoIdx, packets.end(), &six);
+
+    return (1 + std::distance(packets.begin(), twoIdx)) * (1 + std::distance(packets.begin(), sixIdx));
+}
+
+Result solve(const PacketPairs& packetPairs) {
+    AOC_PHASE("solve");
+    return {part1(packetPairs), part2(packetPairs)};
+}
+
+Result solve(std::string_view input, std::pmr::memory_resource *memory) {
+    return solve(parseInput(input, memory));
+}
+
+std::string report(const Result& result) {
+    return std::format("Part 1: {}\nPart 2: {}\n", result.part1, result.part2);
+}
+
+std::string toJson(const Result& result) {
+    return aoc::JsonObject().add("part1", result.part1).add("part2", result.part2).str();
+}
+
+}
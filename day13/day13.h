@@ -0,0 +1,53 @@
+//   Copyright 20/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <boost/json.hpp>
+
+namespace day13 {
+
+using PacketPairs = std::vector<std::tuple<boost::json::value, boost::json::value>>;
+
+// The packets' DOMs allocate from memory, and keep a reference to it
+PacketPairs parseInput(std::string_view input, std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+// Sum of the indices of the pairs that are in the right order
+size_t part1(const PacketPairs& packetPairs);
+
+// Product of the positions of the divider packets once every packet is sorted
+size_t part2(const PacketPairs& packetPairs);
+
+struct Result {
+    size_t part1 = 0;
+    size_t part2 = 0;
+};
+
+Result solve(const PacketPairs& packetPairs);
+Result solve(std::string_view input, std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+// The lines the executable prints for a result
+std::string report(const Result& result);
+
+// The result as a JSON object for --format=json
+std::string toJson(const Result& result);
+
+}
@@ -0,0 +1,59 @@
+//   Copyright 20/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "day13.h"
+#include "aoc/batch.h"
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/memory.h"
+
+int main(int argc, char** argv)
+try {
+    auto allocator = aoc::Allocator::Arena;
+    bool verbose = false;
+    aoc::Batch batch;
+    for (const auto &arg: aoc::expandArguments(argc, argv)) {
+        if (arg == "--verbose") {
+            verbose = true;
+            continue;
+        } else if (arg.starts_with("--alloc=")) {
+            allocator = aoc::parseAllocator(std::string_view(arg).substr(8));
+            continue;
+        } else if (aoc::parseCommonOption(arg, batch)) {
+            continue;
+        }
+        batch.add(arg, [arg, allocator, verbose, format = batch.format()] {
+            aoc::InputFile file(arg);
+            aoc::RunMemory memory(allocator);
+            auto result = day13::solve(file.contents(), memory.resource());
+            if (format == aoc::Format::Json) {
+                return day13::toJson(result);
+            }
+            return (verbose ? "Input file: " + arg + "\n" : "") + day13::report(result) + "\n";
+        });
+    }
+    if (batch.size() == 0) {
+        std::cerr << "No input file specified" << std::endl;
+        return 1;
+    }
+    return batch.finish();
+} catch (const std::exception& ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
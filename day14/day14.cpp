@@ -13,15 +13,19 @@
 //   limitations under the License.
 //
 
-#include <iostream>
-#include <fstream>
+#include "day14.h"
+
+#include <format>
 #include <string>
-#include <set>
 #include <vector>
 #include <numeric>
 
-using Point = std::tuple<int, int>;
-using OccupiedSpots = std::set<Point>;
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/number.h"
+#include "aoc/stats.h"
+
+namespace day14 {
 
 Point operator+(Point a, Point b) {
     return {std::get<0>(a) + std::get<0>(b), std::get<1>(a) + std::get<1>(b)};
@@ -31,27 +35,15 @@ Point operator-(Point a, Point b) {
     return {std::get<0>(a) - std::get<0>(b), std::get<1>(a) - std::get<1>(b)};
 }
 
-int parseNumber(std::string_view str) {
-    auto endPtr = const_cast<char *>(str.data() + str.size());
-    auto n = std::strtol(str.data(), &endPtr, 10);
-    if (endPtr == str.data()) {
-        std::string message = "Failed to parse string as number: '";
-        message.append(str);
-        message.push_back('\'');
-        throw std::runtime_error(message);
-    }
-    return n;
-}
-
-std::vector<Point> parseLine(std::string_view line) {
-    std::vector<Point> points;
+std::pmr::vector<Point> parseLine(std::string_view line, std::pmr::memory_resource *memory) {
+    std::pmr::vector<Point> points(memory);
     for (size_t split = line.find(" -> "), start = 0;
          start != std::string_view::npos;
          start = (split == std::string_view::npos) ? split : split + 4, split = line.find(" -> ", start + 1)
             ) {
         auto comma = line.find(',', start);
-        auto x = parseNumber(line.substr(start, comma - start));
-        auto y = parseNumber(line.substr(comma + 1, split - comma - 1));
+        auto x = aoc::parseNumber<int>(line.substr(start, comma - start));
+        auto y = aoc::parseNumber<int>(line.substr(comma + 1, split - comma - 1));
         points.emplace_back(x, y);
     }
     return points;
@@ -62,11 +54,11 @@ T sign(T val) {
     return (T(0) < val) - (val < T(0));
 }
 
-OccupiedSpots parse(std::istream &input) {
-    OccupiedSpots rocks;
-    std::string line;
-    while (std::getline(input, line)) {
-        auto points = parseLine(line);
+OccupiedSpots parse(std::string_view input, std::pmr::memory_resource *memory) {
+    AOC_PHASE("parse");
+    OccupiedSpots rocks(memory);
+    for (auto line : aoc::Lines(input)) {
+        auto points = parseLine(line, memory);
         for (size_t i = 0; i < points.size() - 1; i++) {
             auto [startX, startY] = points[i];
             auto [endX, endY] = points[i + 1];
@@ -107,47 +99,50 @@ void Grain::findRestingPoint(const OccupiedSpots &occupiedSpots, int floor) {
     }
 }
 
-int main(int argc, char **argv)
-try {
-    for (int i = 1; i < argc; i++) {
-        std::fstream file(argv[i]);
-        if (!file) {
-            std::cerr << "Failed to open input file " << argv[i] << std::endl;
-            return 1;
-        }
-
-        auto occupiedSpots = parse(file);
-
-        auto floor = std::transform_reduce(occupiedSpots.begin(), occupiedSpots.end(), 0,
-                                           [](int a, int b) { return std::max(a, b); },
-                                           [](const Point &point) { return std::get<1>(point); });
-
-        auto part1 = 0;
-        auto part2 = 0;
-        bool floorHit = false;
-
-        while (true) {
-            Grain grain;
-            grain.findRestingPoint(occupiedSpots, floor);
-            if (!floorHit) {
-                if (grain.y >= floor) {
-                    floorHit = true;
-                } else {
-                    part1++;
-                }
-            }
-            occupiedSpots.emplace(grain.x, grain.y);
-            part2++;
-            if (grain.x == 500 && grain.y == 0) {
-                break;
+Result pourSand(OccupiedSpots occupiedSpots) {
+    AOC_PHASE("solve");
+    auto floor = std::transform_reduce(occupiedSpots.begin(), occupiedSpots.end(), 0,
+                                       [](int a, int b) { return std::max(a, b); },
+                                       [](const Point &point) { return std::get<1>(point); });
+
+    auto part1 = 0;
+    auto part2 = 0;
+    bool floorHit = false;
+    // Every move takes a grain one row down
+    [[maybe_unused]] size_t moves = 0;
+
+    while (true) {
+        Grain grain;
+        grain.findRestingPoint(occupiedSpots, floor);
+        if (!floorHit) {
+            if (grain.y >= floor) {
+                floorHit = true;
+            } else {
+                part1++;
             }
         }
-        std::cout << "Part 1: " << part1 << std::endl;
-        std::cout << "Part 2: " << part2 << std::endl;
-        std::cout << std::endl;
+        occupiedSpots.emplace(grain.x, grain.y);
+        moves += grain.y;
+        part2++;
+        if (grain.x == 500 && grain.y == 0) {
+            break;
+        }
     }
-    return 0;
-} catch (const std::exception &ex) {
-    std::cerr << "ERROR: " << ex.what() << std::endl;
-    return 1;
+    AOC_COUNT("grains dropped", part2);
+    AOC_COUNT("grain moves", moves);
+    return {part1, part2};
+}
+
+Result solve(std::string_view input, std::pmr::memory_resource *memory) {
+    return pourSand(parse(input, memory));
+}
+
+std::string report(const Result &result) {
+    return std::format("Part 1: {}\nPart 2: {}\n", result.part1, result.part2);
+}
+
+std::string toJson(const Result &result) {
+    return aoc::JsonObject().add("part1", result.part1).add("part2", result.part2).str();
+}
+
 }
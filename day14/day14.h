@@ -0,0 +1,49 @@
+//   Copyright 21/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+namespace day14 {
+
+using Point = std::tuple<int, int>;
+using OccupiedSpots = std::pmr::set<Point>;
+
+OccupiedSpots parse(std::string_view input, std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+struct Result {
+    // Grains that came to rest before the first one fell to the floor
+    int part1 = 0;
+    // Grains that came to rest before the source was blocked
+    int part2 = 0;
+};
+
+// Pours sand onto the given rocks until the source is blocked; the grains are added with the rocks' allocator
+Result pourSand(OccupiedSpots occupiedSpots);
+
+Result solve(std::string_view input, std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+// The lines the executable prints for a result
+std::string report(const Result &result);
+
+// The result as a JSON object for --format=json
+std::string toJson(const Result &result);
+
+}
@@ -13,57 +13,42 @@
 //   limitations under the License.
 //
 
-#include <iostream>
-#include <fstream>
-#include <vector>
+#include "day15.h"
+
 #include <format>
 #include <string>
-#include <complex>
 #include <algorithm>
 #include <numeric>
-#include <optional>
 
-using Point = std::pair<int, int>;
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/number.h"
+#include "aoc/stats.h"
+
+namespace day15 {
 
 int metric(const Point &a, const Point &b) {
     return std::abs(a.first - b.first) + std::abs(a.second - b.second);
 }
 
-int parseNumber(std::string_view str) {
-    auto endPtr = const_cast<char *>(str.data() + str.size());
-    auto n = std::strtol(str.data(), &endPtr, 10);
-    if (endPtr == str.data()) {
-        throw std::runtime_error(std::format("Failed to parse string as number: '{}'", str));
-    }
-    return n;
-}
-
-struct Sensor {
-    Point location;
-    Point beacon;
-    int strength;
-    explicit Sensor(Point location, Point beacon, int strength)
-    : location(location), beacon(beacon), strength(strength) {}
-};
-
-std::vector<Sensor> parse(std::istream &input) {
-    std::string line;
+std::vector<Sensor> parse(std::string_view input) {
+    AOC_PHASE("parse");
     std::vector<Sensor> sensors;
-    while (std::getline(input, line)) {
+    for (auto line : aoc::Lines(input)) {
         size_t start = 12;
         size_t end = line.find(',', start);
-        auto sensorX = parseNumber(line.substr(start, end - start));
+        auto sensorX = aoc::parseNumber<int>(line.substr(start, end - start));
 
         start = end + 4;
         end = line.find(':', start);
-        auto sensorY = parseNumber(line.substr(start, end - start));
+        auto sensorY = aoc::parseNumber<int>(line.substr(start, end - start));
 
         start = end + 25;
         end = line.find(',', start);
-        auto beaconX = parseNumber(line.substr(start, end - start));
+        auto beaconX = aoc::parseNumber<int>(line.substr(start, end - start));
 
         start = end + 4;
-        auto beaconY = parseNumber(line.substr(start));
+        auto beaconY = aoc::parseNumber<int>(line.substr(start));
 
         Point sensor(sensorX, sensorY);
         Point beacon(beaconX, beaconY);
@@ -108,6 +93,8 @@ public:
 };
 
 void reduce(std::vector<SensorRange>& ranges, int minX, int maxX) {
+    // Clamping a range that misses [minX, maxX] altogether would cover one position at its edge
+    std::erase_if(ranges, [=](const SensorRange& range) { return range.end < minX || range.start > maxX; });
     for (auto& range : ranges) {
         range.start = std::clamp(range.start, minX, maxX);
         range.end = std::clamp(range.end, minX, maxX);
@@ -120,8 +107,8 @@ void reduce(std::vector<SensorRange>& ranges, int minX, int maxX) {
         return a.start < b.start;
     });
 
-    for (size_t i = 0; i < ranges.size() - 1; i++) {
-        while (i < ranges.size() - 1 && ranges[i].overlaps(ranges[i + 1])) {
+    for (size_t i = 0; i + 1 < ranges.size(); i++) {
+        while (i + 1 < ranges.size() && ranges[i].overlaps(ranges[i + 1])) {
             ranges[i] = ranges[i].merge(ranges[i + 1]);
             ranges.erase(ranges.begin() + i + 1);
         }
@@ -140,7 +127,7 @@ auto getRanges(const std::vector<Sensor>& sensors, int minX, int maxX, int y) {
     return ranges;
 }
 
-auto part1(const std::vector<Sensor>& sensors, int row) {
+int part1(const std::vector<Sensor>& sensors, int row) {
     int xMin = INT_MAX;
     int xMax = INT_MIN;
     int strengthMax = 0;
@@ -150,37 +137,69 @@ auto part1(const std::vector<Sensor>& sensors, int row) {
         strengthMax = std::max(strengthMax, strength);
     }
     auto ranges = getRanges(sensors, xMin - strengthMax, xMax + strengthMax, row);
-    return std::transform_reduce(ranges.begin(), ranges.end(), 0, std::plus(), [](const SensorRange& range) {
-        return range.end - range.start;
+    auto covered = std::transform_reduce(ranges.begin(), ranges.end(), 0, std::plus(), [](const SensorRange& range) {
+        return range.end - range.start + 1;
     });
+
+    // A beacon is always within reach of its own sensor, so every one on the row is in a range
+    std::vector<int> beacons;
+    for (const auto& sensor : sensors) {
+        if (sensor.beacon.second == row) {
+            beacons.push_back(sensor.beacon.first);
+        }
+    }
+    std::sort(beacons.begin(), beacons.end());
+    return covered - int(std::unique(beacons.begin(), beacons.end()) - beacons.begin());
 }
 
-void part2(const std::vector<Sensor>& sensors, int row) {
+std::optional<Point> part2(const std::vector<Sensor>& sensors, int row) {
     for (int y = 0; y <= 2 * row; y++) {
         auto ranges = getRanges(sensors, 0, 2 * row, y);
-        if (ranges.size() == 2) {
-            auto x = ranges[0].end + 1;
-            std::cout << std::format("{}{:06}", 4*x, y) << std::endl;
-            return;
+        // The ranges are disjoint and not adjacent, so the first gap is before or just after the
+        // first one, and a row that no sensor reaches is free from its start
+        if (ranges.empty() || ranges.front().start > 0 || ranges.front().end < 2 * row) {
+            AOC_COUNT("rows scanned", y + 1);
+            return Point(ranges.empty() || ranges.front().start > 0 ? 0 : ranges.front().end + 1, y);
         }
     }
+    return std::nullopt;
 }
 
-int main(int argc, char **argv)
-try {
-    for (int i = 2; i < argc; i += 2) {
-        std::fstream file(argv[i - 1]);
-        int row = parseNumber(argv[i]);
+Result solve(const std::vector<Sensor>& sensors, int row) {
+    AOC_PHASE("solve");
+    return {part1(sensors, row), part2(sensors, row)};
+}
+
+Result solve(std::string_view input, int row) {
+    return solve(parse(input), row);
+}
 
-        auto sensors = parse(file);
+namespace {
+    // The tuning frequency of the distress beacon
+    int64_t tuningFrequency(const Point &beacon) {
+        return int64_t(4000000) * beacon.first + beacon.second;
+    }
+}
 
-        std::cout << "Part 1: " << part1(sensors, row) << std::endl;
-        std::cout << "Part 2: ";
-        part2(sensors, row);
-        std::cout << std::endl;
+std::string report(const Result& result) {
+    auto text = std::format("Part 1: {}\nPart 2: ", result.part1);
+    if (result.beacon) {
+        text += std::to_string(tuningFrequency(*result.beacon));
     }
-    return 0;
-} catch (const std::exception &ex) {
-    std::cerr << "ERROR: " << ex.what() << std::endl;
-    return 1;
-}
\ No newline at end of file
+    return text + '\n';
+}
+
+std::string toJson(const Result& result) {
+    aoc::JsonObject json;
+    json.add("part1", result.part1);
+    if (result.beacon) {
+        auto [x, y] = *result.beacon;
+        json.add("part2", tuningFrequency(*result.beacon));
+        json.addRaw("beacon", aoc::JsonObject().add("x", x).add("y", y).str());
+    } else {
+        json.addNull("part2");
+    }
+    return json.str();
+}
+
+}
@@ -0,0 +1,59 @@
+//   Copyright 21/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace day15 {
+
+using Point = std::pair<int, int>;
+
+struct Sensor {
+    Point location;
+    Point beacon;
+    int strength;
+    explicit Sensor(Point location, Point beacon, int strength)
+    : location(location), beacon(beacon), strength(strength) {}
+};
+
+std::vector<Sensor> parse(std::string_view input);
+
+// Number of positions on the given row that cannot hold a beacon
+int part1(const std::vector<Sensor>& sensors, int row);
+
+// Finds the first position, row by row, within twice the given row in each direction that no
+// sensor covers; the puzzle promises there is only one
+std::optional<Point> part2(const std::vector<Sensor>& sensors, int row);
+
+struct Result {
+    int part1 = 0;
+    std::optional<Point> beacon;
+};
+
+Result solve(const std::vector<Sensor>& sensors, int row);
+Result solve(std::string_view input, int row);
+
+// The lines the executable prints for a result
+std::string report(const Result& result);
+
+// The result as a JSON object for --format=json
+std::string toJson(const Result& result);
+
+}
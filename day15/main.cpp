@@ -0,0 +1,56 @@
+//   Copyright 21/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include <iostream>
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "day15.h"
+#include "aoc/batch.h"
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/number.h"
+
+int main(int argc, char **argv)
+try {
+    aoc::Batch batch;
+    // Inputs come in pairs of file and row
+    std::optional<std::string> path;
+    for (const auto &arg: aoc::expandArguments(argc, argv)) {
+        if (aoc::parseCommonOption(arg, batch)) {
+            continue;
+        }
+        if (!path) {
+            path = arg;
+        } else {
+            int row = aoc::parseNumber<int>(arg);
+            batch.add(*path, [path = *path, row, format = batch.format()] {
+                aoc::InputFile file(path);
+                auto result = day15::solve(file.contents(), row);
+                return format == aoc::Format::Json ? day15::toJson(result) : day15::report(result) + "\n";
+            });
+            path.reset();
+        }
+    }
+    if (path) {
+        throw std::runtime_error(std::format("Input file {} has no row", *path));
+    }
+    return batch.finish();
+} catch (const std::exception &ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
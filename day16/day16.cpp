@@ -0,0 +1,427 @@
+//   Copyright 24/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "day16.h"
+
+#include <format>
+#include <unordered_map>
+#include <unordered_set>
+#include <numeric>
+#include <algorithm>
+#include <deque>
+#include <bit>
+
+#include "aoc/cache.h"
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/number.h"
+#include "aoc/stats.h"
+
+namespace day16 {
+
+ValveLabel encodeLabel(std::string_view label) {
+    if (label.size() != 2 || label[0] < 'A' || label[0] > 'Z' || label[1] < 'A' || label[1] > 'Z') {
+        throw std::runtime_error(std::format("Invalid valve label: '{}'", label));
+    }
+    return ValveLabel((label[0] - 'A') << 5 | (label[1] - 'A'));
+}
+
+std::string decodeLabel(ValveLabel label) {
+    return {char('A' + (label >> 5)), char('A' + (label & 0x1f))};
+}
+
+namespace {
+    // Whether label is one that encodeLabel gives, rather than two letters' worth of other bits
+    bool isLabel(ValveLabel label) {
+        return (label >> 5) < 26 && (label & 0x1f) < 26;
+    }
+}
+
+ValveNetwork parse(std::string_view input) {
+    ValveNetwork network;
+    {
+        AOC_PHASE("parse");
+        // Tunnels are recorded by label until every valve has an index
+        std::vector<ValveLabel> destinations;
+        network.tunnelOffsets.push_back(0);
+        for (auto l : aoc::Lines(input)) {
+            auto label = encodeLabel(l.substr(6, 2));
+            auto semi = l.find(';');
+            auto flowRate = aoc::parseNumber<size_t>(l.substr(23, semi - 23));
+
+            auto start = l.find("to valves ", semi);
+            if (start == std::string_view::npos) {
+                start = l.find("to valve ", semi);
+                start += 9;
+            } else {
+                start += 10;
+            }
+            // Destinations are two letter labels separated by ", "
+            for (; start < l.size(); start += 4) {
+                destinations.push_back(encodeLabel(l.substr(start, 2)));
+            }
+
+            if (network.indices[label] != ValveNetwork::NoValve) {
+                throw std::runtime_error(std::format("Duplicate valve: '{}'", decodeLabel(label)));
+            }
+            network.indices[label] = (uint32_t) network.valves.size();
+            network.valves.push_back({flowRate, label, {}});
+            network.tunnelOffsets.push_back((uint32_t) destinations.size());
+        }
+
+        network.tunnels.reserve(destinations.size());
+        for (auto destination: destinations) {
+            auto index = network.indices[destination];
+            if (index == ValveNetwork::NoValve) {
+                throw std::runtime_error(std::format("Tunnel leads to unknown valve: '{}'", decodeLabel(destination)));
+            }
+            network.tunnels.push_back(index);
+        }
+    }
+
+    network.calculateDistances();
+    return network;
+}
+
+std::string packNetwork(const ValveNetwork &network) {
+    aoc::Packer packer;
+    packer.put(uint64_t(network.size()));
+    for (const auto &valve: network.valves) {
+        packer.put(uint64_t(valve.flowRate));
+        packer.put(valve.label);
+        packer.putArray(std::span(valve.distances));
+    }
+    packer.putArray(std::span(network.tunnelOffsets));
+    packer.putArray(std::span(network.tunnels));
+    return packer.take();
+}
+
+ValveNetwork unpackNetwork(std::string_view packed) {
+    aoc::Unpacker unpacker(packed);
+    ValveNetwork network;
+    // Every valve takes more than a byte, so a larger count can only be corruption
+    auto count = unpacker.get<uint64_t>();
+    if (count > packed.size()) {
+        throw std::runtime_error("Corrupt cache entry");
+    }
+    network.valves.resize(count);
+    for (uint32_t i = 0; i < network.size(); i++) {
+        auto &valve = network.valves[i];
+        valve.flowRate = unpacker.get<uint64_t>();
+        valve.label = unpacker.get<ValveLabel>();
+        valve.distances = unpacker.getArray<size_t>();
+        if (!isLabel(valve.label) || network.indices[valve.label] != ValveNetwork::NoValve) {
+            throw std::runtime_error("Corrupt cache entry");
+        }
+        network.indices[valve.label] = i;
+    }
+    network.tunnelOffsets = unpacker.getArray<uint32_t>();
+    network.tunnels = unpacker.getArray<uint32_t>();
+
+    auto valid = unpacker.done() && network.tunnelOffsets.size() == network.size() + 1
+                 && network.tunnelOffsets.back() == network.tunnels.size()
+                 && std::is_sorted(network.tunnelOffsets.begin(), network.tunnelOffsets.end())
+                 && std::all_of(network.tunnels.begin(), network.tunnels.end(),
+                                [&](uint32_t to) { return to < network.size(); })
+                 && std::all_of(network.valves.begin(), network.valves.end(),
+                                [&](const Valve &v) { return v.distances.size() == network.size(); });
+    if (!valid) {
+        throw std::runtime_error("Corrupt cache entry");
+    }
+    return network;
+}
+
+void ValveNetwork::calculateDistances() {
+    AOC_PHASE("preprocess");
+    // Every tunnel takes one minute, so a breadth first search from each valve
+    // visits the others in the same order Dijkstra's algorithm would
+    std::vector<uint32_t> queue(size());
+    for (size_t source = 0; source < size(); source++) {
+        auto &distances = valves[source].distances;
+        distances.assign(size(), Valve::Unreachable);
+        distances[source] = 0;
+
+        size_t head = 0;
+        size_t tail = 0;
+        queue[tail++] = (uint32_t) source;
+        while (head < tail) {
+            auto valve = queue[head++];
+            for (auto neighbour: neighbours(valve)) {
+                if (distances[neighbour] == Valve::Unreachable) {
+                    distances[neighbour] = distances[valve] + 1;
+                    queue[tail++] = neighbour;
+                }
+            }
+        }
+    }
+}
+
+struct State {
+    // The valve we're currently at
+    const Valve* current;
+    // All the valves opened in our history with the time they were opened at
+    std::pmr::unordered_map<const Valve*, size_t> openedValves;
+    // How many minutes have elapsed since we started
+    size_t elapsedTime;
+
+    State(const Valve* current, std::pmr::unordered_map<const Valve*, size_t> openedValves, size_t elapsedTime)
+    : current(current), openedValves(std::move(openedValves)), elapsedTime(elapsedTime) {}
+
+    constexpr auto operator<=>(const State &state) const noexcept { return elapsedTime <=> state.elapsedTime; }
+
+    [[nodiscard]] size_t currentPressurePerMinute() const {
+        return std::transform_reduce(openedValves.begin(), openedValves.end(), size_t(0), std::plus(),
+                           [](const auto& kv) -> size_t {
+            return kv.first->flowRate;
+        });
+    }
+
+    [[nodiscard]] size_t totalPressureRelieved(size_t timeLimit) const {
+        return std::transform_reduce(openedValves.begin(), openedValves.end(), size_t(0), std::plus(),
+                                     [timeLimit](const auto& kv) -> size_t {
+            if (kv.second >= timeLimit)
+                return 0;
+            return kv.first->flowRate * (timeLimit - kv.second);
+        });
+    }
+};
+
+Route part1(const ValveNetwork &network, size_t timeLimit, std::pmr::memory_resource *memory) {
+    std::pmr::deque<State> states(memory);
+    auto start = &network.at("AA");
+    // Copies made with the map's copy constructor would go back to the default resource, so every
+    // map is either moved or copied into memory explicitly
+    State maxState(start, std::pmr::unordered_map<const Valve*, size_t>(memory), 0);
+    states.push_back(maxState);
+    size_t max = 0;
+    [[maybe_unused]] size_t expanded = 0;
+
+    while (!states.empty()) {
+        // Pop a possible state from the queue
+        auto state = std::move(states.front());
+        states.pop_front();
+        expanded++;
+
+        bool addedAnyStates = false;
+        // For each other valve in the network
+        for (size_t index = 0; index < network.size(); index++) {
+            auto target = &network.valves[index];
+            auto distance = state.current->distances[index];
+            // If that valve can be reached and is not yet open in this state
+            if (distance != Valve::Unreachable && !state.openedValves.contains(target) && target->flowRate > 0
+                && state.elapsedTime < timeLimit) {
+                // Create a new state that represents spending 'distance' minutes moving to that point and opening
+                // that valve in the next minute
+                std::pmr::unordered_map<const Valve*, size_t> newOpenedValves(state.openedValves, memory);
+                newOpenedValves[target] = state.elapsedTime + distance + 1;
+                State nextState(target, std::move(newOpenedValves), state.elapsedTime + distance + 1);
+                states.emplace_back(std::move(nextState));
+                addedAnyStates = true;
+            }
+        }
+
+        if (!addedAnyStates) {
+            auto finalPressure = state.totalPressureRelieved(timeLimit);
+            if (finalPressure > max) {
+                max = finalPressure;
+                maxState = state;
+            }
+        }
+    }
+
+    AOC_COUNT("states expanded", expanded);
+    Route route{max, maxState.elapsedTime, maxState.currentPressurePerMinute(), {}};
+    for (const auto& kv : maxState.openedValves) {
+        route.openings.emplace_back(kv.first->name(), kv.second);
+    }
+    return route;
+}
+
+// Gathers the bits of mask selected by reachable into the low bits of the result, a byte at a time
+size_t PressureTable::compress(uint32_t mask, uint32_t reachable) noexcept {
+    static const auto byteTable = [] {
+        std::vector<uint8_t> table(256 * 256);
+        for (uint32_t r = 0; r < 256; r++) {
+            for (uint32_t m = 0; m < 256; m++) {
+                uint8_t packed = 0;
+                for (uint32_t bit = 0, out = 0; bit < 8; bit++) {
+                    if (r & (1 << bit)) {
+                        packed |= ((m >> bit) & 1) << out++;
+                    }
+                }
+                table[r * 256 + m] = packed;
+            }
+        }
+        return table;
+    }();
+
+    size_t index = 0;
+    int shift = 0;
+    for (; reachable != 0; reachable >>= 8, mask >>= 8) {
+        auto r = reachable & 0xff;
+        index |= size_t(byteTable[r * 256 + (mask & 0xff)]) << shift;
+        shift += std::popcount(r);
+    }
+    return index;
+}
+
+uint32_t PressureTable::expand(size_t index, uint32_t reachable) noexcept {
+    uint32_t mask = 0;
+    for (; reachable != 0 && index != 0; index >>= 1, reachable &= reachable - 1) {
+        if (index & 1) {
+            mask |= reachable & -reachable;
+        }
+    }
+    return mask;
+}
+
+size_t PressureTable::lookup(size_t t, size_t p, uint32_t mask) const {
+    const auto &s = slice(t, p);
+    return values[s.offset + compress(mask, s.reachable)];
+}
+
+// Best pressure from a position that can reach the useful valves in candidates within t minutes
+template <typename DistanceFn>
+size_t PressureTable::bestFrom(DistanceFn &&distanceTo, uint32_t candidates, size_t t, uint32_t mask) const {
+    size_t best = 0;
+    for (candidates &= ~mask; candidates != 0; candidates &= candidates - 1) {
+        auto q = (size_t) std::countr_zero(candidates);
+        auto remaining = t - distanceTo(q) - 1;
+        best = std::max(best, flowRates[q] * remaining + lookup(remaining, q, mask | (uint32_t(1) << q)));
+    }
+    return best;
+}
+
+size_t PressureTable::best(const Valve &start, size_t timeLimit, uint32_t openedMask) const {
+    if (timeLimit > budget) {
+        throw std::runtime_error(std::format("Time limit {} exceeds table budget {}", timeLimit, budget));
+    }
+    uint32_t candidates = 0;
+    for (size_t q = 0; q < useful.size(); q++) {
+        if (start.distances[useful[q]] + 1 < timeLimit) {
+            candidates |= uint32_t(1) << q;
+        }
+    }
+    return bestFrom([&](size_t q) { return start.distances[useful[q]]; }, candidates, timeLimit, openedMask);
+}
+
+PressureTable::PressureTable(const ValveNetwork &network, size_t budget) : budget(budget) {
+    AOC_PHASE("preprocess");
+    for (const auto &valve: network.valves) {
+        if (valve.flowRate > 0) {
+            useful.push_back(network.indexOf(&valve));
+        }
+    }
+    std::sort(useful.begin(), useful.end(), [&](size_t a, size_t b) {
+        return network.valves[a].label < network.valves[b].label;
+    });
+    if (useful.size() > 31) {
+        throw std::runtime_error(std::format("Too many valves with non-zero flow rate: {}", useful.size()));
+    }
+
+    distances.resize(useful.size());
+    for (size_t p = 0; p < useful.size(); p++) {
+        const auto &valve = network.valves[useful[p]];
+        flowRates.push_back(valve.flowRate);
+        for (auto q: useful) {
+            distances[p].push_back(valve.distances[q]);
+        }
+    }
+    // No entry can be more than every valve open for the whole budget, so this bounds them all
+    auto totalFlow = std::accumulate(flowRates.begin(), flowRates.end(), size_t(0));
+    if (totalFlow > UINT32_MAX / std::max<size_t>(budget, 1)) {
+        throw std::runtime_error(std::format("Flow rates totalling {} are too high for the table", totalFlow));
+    }
+
+    // Lay out every slice before filling any of them so the lookups below can index freely
+    slices.resize((budget + 1) * useful.size());
+    size_t total = 0;
+    for (size_t t = 0; t <= budget; t++) {
+        for (size_t p = 0; p < useful.size(); p++) {
+            auto &s = slices[t * useful.size() + p];
+            for (size_t q = 0; q < useful.size(); q++) {
+                if (q != p && distances[p][q] + 1 < t) {
+                    s.reachable |= uint32_t(1) << q;
+                }
+            }
+            s.offset = total;
+            total += size_t(1) << std::popcount(s.reachable);
+        }
+    }
+    values.resize(total);
+
+    // Slices for t only depend on slices for strictly smaller t
+    for (size_t t = 0; t <= budget; t++) {
+        for (size_t p = 0; p < useful.size(); p++) {
+            const auto &s = slice(t, p);
+            auto count = size_t(1) << std::popcount(s.reachable);
+            for (size_t index = 0; index < count; index++) {
+                // Fits, as the total flow was checked against the budget above
+                values[s.offset + index] = (uint32_t) bestFrom([&](size_t q) { return distances[p][q]; },
+                                                               s.reachable, t, expand(index, s.reachable) | (uint32_t(1) << p));
+            }
+        }
+    }
+    AOC_COUNT("table entries", values.size());
+}
+
+Result solve(const ValveNetwork &network, Engine engine, std::pmr::memory_resource *memory) {
+    if (engine == Engine::Table) {
+        PressureTable table(network, TimeLimit);
+        AOC_PHASE("solve");
+        return {table.best(network.at("AA"), TimeLimit), std::nullopt};
+    }
+    AOC_PHASE("solve");
+    auto route = part1(network, TimeLimit, memory);
+    return {route.pressure, std::move(route)};
+}
+
+Result solve(std::string_view input, Engine engine, std::pmr::memory_resource *memory) {
+    return solve(parse(input), engine, memory);
+}
+
+std::string report(const Result &result, bool showRoute) {
+    std::string text;
+    if (showRoute && result.route) {
+        const auto &route = *result.route;
+        text += std::format("Final state is at time {} with valves\n", route.finalTime);
+        for (const auto &[name, minute]: route.openings) {
+            text += std::format(" * {} opened at minute {}\n", name, minute);
+        }
+        text += std::format("releasing {} pressure per minute for a total of {}\n",
+                            route.pressurePerMinute, route.pressure);
+    }
+    return text + std::format("Part 1: {}\n", result.part1);
+}
+
+std::string toJson(const Result &result, bool showRoute) {
+    aoc::JsonObject json;
+    json.add("part1", result.part1);
+    if (showRoute && result.route) {
+        std::vector<std::string> openings;
+        for (const auto &[name, minute]: result.route->openings) {
+            openings.push_back(aoc::JsonObject().add("valve", name).add("minute", minute).str());
+        }
+        json.addRaw("route", aoc::JsonObject()
+                .add("finalTime", result.route->finalTime)
+                .add("pressurePerMinute", result.route->pressurePerMinute)
+                .add("pressure", result.route->pressure)
+                .addRaw("openings", aoc::jsonArray(openings))
+                .str());
+    }
+    return json.str();
+}
+
+}
@@ -0,0 +1,202 @@
+//   Copyright 24/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace day16 {
+
+/**
+ * Valve labels are always two upper case letters, so they are interned as a 10-bit
+ * integer at parse time and never compared or hashed as strings afterwards.
+ */
+using ValveLabel = uint16_t;
+
+constexpr size_t LabelCount = 1 << 10;
+
+ValveLabel encodeLabel(std::string_view label);
+std::string decodeLabel(ValveLabel label);
+
+struct Valve {
+    // The distance to a valve that no tunnels lead to from this one
+    static constexpr size_t Unreachable = UINT32_MAX;
+
+    size_t flowRate = 0;
+    ValveLabel label = 0;
+    // Shortest distance to every valve in the network, indexed by valve index
+    std::vector<size_t> distances;
+
+    [[nodiscard]] std::string name() const { return decodeLabel(label); }
+};
+
+/**
+ * The valves are stored contiguously in input order and the tunnels between them are held
+ * in compressed sparse row form: the neighbours of valve i are
+ * tunnels[tunnelOffsets[i]] .. tunnels[tunnelOffsets[i + 1]].
+ */
+struct ValveNetwork {
+    static constexpr uint32_t NoValve = UINT32_MAX;
+
+    std::vector<Valve> valves;
+    std::vector<uint32_t> tunnelOffsets;
+    std::vector<uint32_t> tunnels;
+    // Maps each interned label to its index in valves
+    std::vector<uint32_t> indices = std::vector<uint32_t>(LabelCount, NoValve);
+
+    [[nodiscard]] size_t size() const noexcept { return valves.size(); }
+
+    [[nodiscard]] size_t indexOf(const Valve *valve) const noexcept { return valve - valves.data(); }
+
+    [[nodiscard]] const Valve &at(std::string_view label) const {
+        auto index = indices[encodeLabel(label)];
+        if (index == NoValve) {
+            throw std::runtime_error(std::format("No such valve: '{}'", label));
+        }
+        return valves[index];
+    }
+
+    [[nodiscard]] std::span<const uint32_t> neighbours(size_t index) const {
+        return {tunnels.data() + tunnelOffsets[index], tunnels.data() + tunnelOffsets[index + 1]};
+    }
+
+    // Valves that cannot be reached from one another are left Unreachable
+    void calculateDistances();
+};
+
+ValveNetwork parse(std::string_view input);
+
+// Bump whenever a change alters the reports or packed networks cached for an input
+constexpr std::string_view CacheVersion = "day16/1";
+
+// The network with its distances as a cache entry, so they need not be searched for again
+std::string packNetwork(const ValveNetwork &network);
+ValveNetwork unpackNetwork(std::string_view packed);
+
+// Minutes until the volcano erupts
+constexpr size_t TimeLimit = 30;
+
+// The best sequence of valves to open found by searching every order of them
+struct Route {
+    size_t pressure = 0;
+    // Minute the last valve was opened
+    size_t finalTime = 0;
+    size_t pressurePerMinute = 0;
+    // Each valve opened with the minute it was opened at
+    std::vector<std::pair<std::string, size_t>> openings;
+};
+
+// The search's states all allocate from memory, which should be able to reuse freed blocks
+Route part1(const ValveNetwork &network, size_t timeLimit,
+            std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+/**
+ * Bottom-up dynamic programme over (minutes remaining, position, opened valves).
+ *
+ * Only the valves with a non-zero flow rate are worth moving to, so positions and the
+ * opened mask range over those. We only ever arrive at p by opening it, and for each (t, p)
+ * only the other valves still reachable from p with t minutes left can contribute, so the
+ * mask is compressed down to those bits and each (t, p) slice stores 2^(reachable valves)
+ * entries. The table is built once from t = 0 upwards and then answers "start at valve X
+ * with T minutes and these valves already open" for any X and any T up to the build budget.
+ */
+class PressureTable {
+    struct Slice {
+        // Bitmask of useful valves, other than the one we are stood at, that can be reached and
+        // opened with time to spare
+        uint32_t reachable = 0;
+        // Offset of this slice's entries in values
+        size_t offset = 0;
+    };
+
+    size_t budget;
+    // Network indices of the valves worth opening
+    std::vector<size_t> useful;
+    std::vector<size_t> flowRates;
+    std::vector<std::vector<size_t>> distances;
+    std::vector<Slice> slices;
+    std::vector<uint32_t> values;
+
+    [[nodiscard]] const Slice &slice(size_t t, size_t p) const { return slices[t * useful.size() + p]; }
+
+    // Gathers the bits of mask selected by reachable into the low bits of the result, a byte at a time
+    static size_t compress(uint32_t mask, uint32_t reachable) noexcept;
+    static uint32_t expand(size_t index, uint32_t reachable) noexcept;
+
+    [[nodiscard]] size_t lookup(size_t t, size_t p, uint32_t mask) const;
+
+    // Best pressure from a position that can reach the useful valves in candidates within t minutes
+    template <typename DistanceFn>
+    [[nodiscard]] size_t bestFrom(DistanceFn &&distanceTo, uint32_t candidates, size_t t, uint32_t mask) const;
+
+public:
+    // Throws if the most pressure that could be relieved within budget would not fit in an entry
+    PressureTable(const ValveNetwork &network, size_t budget);
+
+    [[nodiscard]] size_t timeBudget() const noexcept { return budget; }
+
+    [[nodiscard]] size_t entries() const noexcept { return values.size(); }
+
+    /**
+     * Returns the bit that represents the valve with the given network index in an opened
+     * mask, or zero if opening the valve cannot relieve any pressure.
+     */
+    [[nodiscard]] uint32_t maskOf(size_t index) const {
+        auto it = std::find(useful.begin(), useful.end(), index);
+        return it == useful.end() ? 0 : uint32_t(1) << std::distance(useful.begin(), it);
+    }
+
+    /**
+     * The most pressure that can be relieved starting at the given valve with timeLimit
+     * minutes remaining, where the valves in openedMask are already open.
+     */
+    [[nodiscard]] size_t best(const Valve &start, size_t timeLimit, uint32_t openedMask = 0) const;
+};
+
+enum class Engine : uint8_t {
+    // Breadth first search over every order of opening valves, which also gives the route
+    Search,
+    // Lookup in a PressureTable
+    Table,
+};
+
+struct Result {
+    size_t part1 = 0;
+    // Only the search engine finds the route
+    std::optional<Route> route;
+};
+
+Result solve(const ValveNetwork &network, Engine engine,
+             std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+Result solve(std::string_view input, Engine engine,
+             std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+// The lines the executable prints for a result, with the route when there is one if showRoute
+std::string report(const Result &result, bool showRoute = false);
+
+// The result as a JSON object for --format=json, with the route as report has it
+std::string toJson(const Result &result, bool showRoute = false);
+
+}
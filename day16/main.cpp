@@ -0,0 +1,88 @@
+//   Copyright 24/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include <iostream>
+#include <format>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "day16.h"
+#include "aoc/batch.h"
+#include "aoc/cache.h"
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/memory.h"
+
+int main(int argc, char **argv)
+try {
+    auto engine = day16::Engine::Search;
+    // --alloc=arena takes a quarter off the search's time, but never reuses what it frees, so it
+    // roughly doubles peak memory, and --jobs multiplies that by every input in flight
+    auto allocator = aoc::Allocator::Default;
+    std::shared_ptr<const aoc::DiskCache> cache;
+    // The route of the best state is a debugging trace, so only printed when asked for
+    bool verbose = false;
+    aoc::Batch batch;
+    for (const auto &arg: aoc::expandArguments(argc, argv)) {
+        if (arg == "--engine=dp") {
+            engine = day16::Engine::Table;
+            continue;
+        } else if (arg == "--engine=search") {
+            engine = day16::Engine::Search;
+            continue;
+        } else if (arg.starts_with("--alloc=")) {
+            allocator = aoc::parseAllocator(std::string_view(arg).substr(8));
+            continue;
+        } else if (arg == "--verbose") {
+            verbose = true;
+            continue;
+        } else if (arg == "--cache") {
+            cache = std::make_shared<aoc::DiskCache>(aoc::DiskCache::defaultDirectory());
+            continue;
+        } else if (arg.starts_with("--cache=")) {
+            cache = std::make_shared<aoc::DiskCache>(arg.substr(8));
+            continue;
+        } else if (aoc::parseCommonOption(arg, batch)) {
+            continue;
+        }
+
+        batch.add(arg, [arg, engine, allocator, cache, verbose, format = batch.format()] {
+            aoc::InputFile file(arg);
+            auto input = file.contents();
+            aoc::RunMemory memory(allocator);
+            auto render = [&](const day16::Result &result) {
+                return format == aoc::Format::Json ? day16::toJson(result, verbose) : day16::report(result, verbose);
+            };
+            if (!cache) {
+                return render(day16::solve(input, engine, memory.resource()));
+            }
+            // A new engine for a known input still reuses the network and its distances
+            auto key = std::format("{} engine={} format={} verbose={}", day16::CacheVersion,
+                                   engine == day16::Engine::Table ? "dp" : "search",
+                                   format == aoc::Format::Json ? "json" : "text", verbose);
+            return cache->fetch("day16-report", key, input, [&] {
+                auto network = cache->fetch("day16-network", day16::CacheVersion, input, [&] {
+                    return day16::packNetwork(day16::parse(input));
+                }, day16::unpackNetwork);
+                return render(day16::solve(network, engine, memory.resource()));
+            });
+        });
+    }
+    return batch.finish();
+} catch (const std::exception &ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,1331 @@
+//   Copyright 28/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "day18.h"
+
+#include <exception>
+#include <numeric>
+#include <optional>
+#include <deque>
+#include <tuple>
+#include <atomic>
+#include <thread>
+#include <cstring>
+
+#include "aoc/cache.h"
+#include "aoc/cpu.h"
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/number.h"
+#include "aoc/stats.h"
+
+#if AOC_X86
+#include <immintrin.h>
+#endif
+
+namespace day18 {
+
+std::pmr::set<Cube> parse(std::string_view input, std::pmr::memory_resource *memory) {
+    AOC_PHASE("parse");
+    std::pmr::set<Cube> cubes(memory);
+    for (auto l : aoc::Lines(input)) {
+        auto comma = l.find(',');
+        auto comma2 = l.find(',', comma + 1);
+
+        auto x = aoc::parseNumber<uint32_t>(l.substr(0, comma));
+        auto y = aoc::parseNumber<uint32_t>(l.substr(comma + 1, comma2 - comma - 1));
+        auto z = aoc::parseNumber<uint32_t>(l.substr(comma2 + 1));
+
+        cubes.insert({x, y, z});
+    }
+    return cubes;
+}
+
+size_t surfaceArea(const std::pmr::set<Cube> &cubes) {
+    size_t count = 0;
+    for (const auto& [x, y, z] : cubes) {
+        count += !cubes.contains({x - 1, y, z});
+        count += !cubes.contains({x + 1, y, z});
+        count += !cubes.contains({x, y - 1, z});
+        count += !cubes.contains({x, y + 1, z});
+        count += !cubes.contains({x, y, z - 1});
+        count += !cubes.contains({x, y, z + 1});
+    }
+    return count;
+}
+
+template <typename Fn>
+void xyPlane(const Cube& min, const Cube& max, Fn&& fn) {
+    for (uint32_t y = min.y; y <= max.y; y++) {
+        for (uint32_t x = min.x; x <= max.x; x++) {
+            fn(x, y);
+        }
+    }
+}
+
+template <typename Fn>
+void xzPlane(const Cube& min, const Cube& max, Fn&& fn) {
+    for (uint32_t z = min.z; z <= max.z; z++) {
+        for (uint32_t x = min.x; x <= max.x; x++) {
+            fn(x, z);
+        }
+    }
+}
+
+template <typename Fn>
+void yzPlane(const Cube& min, const Cube& max, Fn&& fn) {
+    for (uint32_t z = min.z; z <= max.z; z++) {
+        for (uint32_t y = min.y; y <= max.y; y++) {
+            fn(y, z);
+        }
+    }
+}
+
+namespace {
+    /**
+     * Adds the voxels of a row to voxels, and to shared the faces they share with each other
+     * and with the rows down and below, either of which may be null. Nearly all of it is
+     * popcounts, which without POPCNT are a library call each.
+     */
+    [[gnu::always_inline]] inline void countRowFaces(const uint64_t *r, const uint64_t *down, const uint64_t *below,
+                                                     size_t n, size_t &voxels, size_t &shared) noexcept {
+        for (size_t i = 0; i < n; i++) {
+            auto carry = i + 1 < n ? r[i + 1] << 63 : 0;
+            voxels += std::popcount(r[i]);
+            shared += std::popcount(r[i] & (r[i] >> 1 | carry));
+            if (down) shared += std::popcount(r[i] & down[i]);
+            if (below) shared += std::popcount(r[i] & below[i]);
+        }
+    }
+
+    /**
+     * The faces of the voxels in row r that touch a voxel of o, the same row of another grid,
+     * or of o's four neighbouring rows, any of which may be null.
+     */
+    [[gnu::always_inline]] inline size_t countTouchingFaces(const uint64_t *r, const uint64_t *o,
+                                                            const uint64_t *oDown, const uint64_t *oUp,
+                                                            const uint64_t *oBelow, const uint64_t *oAbove,
+                                                            size_t n) noexcept {
+        size_t faces = 0;
+        for (size_t i = 0; i < n; i++) {
+            auto fromBelow = i > 0 ? o[i - 1] >> 63 : 0;
+            auto fromAbove = i + 1 < n ? o[i + 1] << 63 : 0;
+            faces += std::popcount(r[i] & (o[i] << 1 | fromBelow));
+            faces += std::popcount(r[i] & (o[i] >> 1 | fromAbove));
+            if (oDown) faces += std::popcount(r[i] & oDown[i]);
+            if (oUp) faces += std::popcount(r[i] & oUp[i]);
+            if (oBelow) faces += std::popcount(r[i] & oBelow[i]);
+            if (oAbove) faces += std::popcount(r[i] & oAbove[i]);
+        }
+        return faces;
+    }
+
+    void rowFacesScalar(const uint64_t *r, const uint64_t *down, const uint64_t *below, size_t n,
+                        size_t &voxels, size_t &shared) noexcept {
+        countRowFaces(r, down, below, n, voxels, shared);
+    }
+
+    size_t touchingFacesScalar(const uint64_t *r, const uint64_t *o, const uint64_t *oDown, const uint64_t *oUp,
+                               const uint64_t *oBelow, const uint64_t *oAbove, size_t n) noexcept {
+        return countTouchingFaces(r, o, oDown, oUp, oBelow, oAbove, n);
+    }
+
+#if AOC_X86
+    AOC_TARGET("popcnt")
+    void rowFacesPopcnt(const uint64_t *r, const uint64_t *down, const uint64_t *below, size_t n,
+                        size_t &voxels, size_t &shared) noexcept {
+        countRowFaces(r, down, below, n, voxels, shared);
+    }
+
+    AOC_TARGET("popcnt")
+    size_t touchingFacesPopcnt(const uint64_t *r, const uint64_t *o, const uint64_t *oDown, const uint64_t *oUp,
+                               const uint64_t *oBelow, const uint64_t *oAbove, size_t n) noexcept {
+        return countTouchingFaces(r, o, oDown, oUp, oBelow, oAbove, n);
+    }
+
+    aoc::cpu::Kernel<decltype(&rowFacesScalar)> rowFaces("day18 rowFaces", rowFacesScalar, rowFacesPopcnt);
+    aoc::cpu::Kernel<decltype(&touchingFacesScalar)> touchingFaces("day18 touchingFaces", touchingFacesScalar,
+                                                                   touchingFacesPopcnt);
+#else
+    aoc::cpu::Kernel<decltype(&rowFacesScalar)> rowFaces("day18 rowFaces", rowFacesScalar);
+    aoc::cpu::Kernel<decltype(&touchingFacesScalar)> touchingFaces("day18 touchingFaces", touchingFacesScalar);
+#endif
+}
+
+size_t VoxelGrid::count() const noexcept {
+    return std::transform_reduce(words.begin(), words.end(), size_t(0), std::plus(),
+                                 [](uint64_t word) -> size_t { return std::popcount(word); });
+}
+
+/**
+ * Splits [0, count) into one contiguous range per worker, runs fn(begin, end) on each and
+ * sums the results. The workers only meet at the atomic total.
+ */
+template <typename Fn>
+size_t parallelReduce(size_t count, size_t threads, Fn &&fn) {
+    threads = std::min(threads, count);
+    if (threads <= 1) {
+        return fn(size_t(0), count);
+    }
+
+    std::atomic<size_t> total = 0;
+    {
+        std::vector<std::jthread> workers;
+        for (size_t t = 0; t < threads; t++) {
+            workers.emplace_back([&fn, &total, begin = count * t / threads, end = count * (t + 1) / threads] {
+                total.fetch_add(fn(begin, end), std::memory_order_relaxed);
+            });
+        }
+    }
+    return total.load(std::memory_order_relaxed);
+}
+
+size_t VoxelGrid::surfaceArea(size_t threads) const {
+    return parallelReduce(depth, threads, [this](size_t zBegin, size_t zEnd) {
+        size_t voxels = 0;
+        size_t shared = 0;
+        for (size_t z = zBegin; z < zEnd; z++) {
+            for (size_t y = 0; y < height; y++) {
+                const auto *r = row(y, z);
+                // The padding guarantees the first row and slice are empty, so they need no neighbour
+                const auto *down = y > 0 ? row(y - 1, z) : nullptr;
+                const auto *below = z > 0 ? row(y, z - 1) : nullptr;
+                rowFaces(r, down, below, wordsPerRow, voxels, shared);
+            }
+        }
+        return 6 * voxels - 2 * shared;
+    });
+}
+
+VoxelGrid VoxelGrid::floodQueue(size_t &faces) const {
+    VoxelGrid visited(originX, originY, originZ, width, height, depth);
+    faces = 0;
+    if (words.empty()) {
+        return visited;
+    }
+
+    std::deque<std::tuple<uint32_t, uint32_t, uint32_t>> frontier;
+    auto visit = [&](size_t x, size_t y, size_t z) {
+        if (test(x, y, z)) {
+            faces++;
+        } else if (!visited.test(x, y, z)) {
+            visited.set(x, y, z);
+            frontier.emplace_back(x, y, z);
+        }
+    };
+
+    visit(0, 0, 0);
+    [[maybe_unused]] size_t flooded = 0;
+    while (!frontier.empty()) {
+        auto [x, y, z] = frontier.front();
+        frontier.pop_front();
+        flooded++;
+
+        if (x > 0) visit(x - 1, y, z);
+        if (x + 1 < width) visit(x + 1, y, z);
+        if (y > 0) visit(x, y - 1, z);
+        if (y + 1 < height) visit(x, y + 1, z);
+        if (z > 0) visit(x, y, z - 1);
+        if (z + 1 < depth) visit(x, y, z + 1);
+    }
+    AOC_COUNT("air voxels flooded", flooded);
+    return visited;
+}
+
+namespace {
+    // Kogge-Stone occluded fills: spread the seeds through runs of free bits towards the high
+    // and low end of the word respectively
+    uint64_t fillUp(uint64_t seeds, uint64_t free) noexcept {
+        seeds &= free;
+        seeds |= free & (seeds << 1);
+        free &= free << 1;
+        seeds |= free & (seeds << 2);
+        free &= free << 2;
+        seeds |= free & (seeds << 4);
+        free &= free << 4;
+        seeds |= free & (seeds << 8);
+        free &= free << 8;
+        seeds |= free & (seeds << 16);
+        free &= free << 16;
+        seeds |= free & (seeds << 32);
+        return seeds;
+    }
+
+    uint64_t fillDown(uint64_t seeds, uint64_t free) noexcept {
+        seeds &= free;
+        seeds |= free & (seeds >> 1);
+        free &= free >> 1;
+        seeds |= free & (seeds >> 2);
+        free &= free >> 2;
+        seeds |= free & (seeds >> 4);
+        free &= free >> 4;
+        seeds |= free & (seeds >> 8);
+        free &= free >> 8;
+        seeds |= free & (seeds >> 16);
+        free &= free >> 16;
+        seeds |= free & (seeds >> 32);
+        return seeds;
+    }
+
+    // seeds = (a | b | c | d | e) & free over a whole row
+    void dilateRowScalar(uint64_t *seeds, const uint64_t *a, const uint64_t *b, const uint64_t *c, const uint64_t *d,
+                         const uint64_t *e, const uint64_t *free, size_t n) noexcept {
+        for (size_t i = 0; i < n; i++) {
+            seeds[i] = (a[i] | b[i] | c[i] | d[i] | e[i]) & free[i];
+        }
+    }
+
+#if AOC_X86
+    AOC_TARGET("avx2")
+    void dilateRowAvx2(uint64_t *seeds, const uint64_t *a, const uint64_t *b, const uint64_t *c, const uint64_t *d,
+                       const uint64_t *e, const uint64_t *free, size_t n) noexcept {
+        size_t i = 0;
+        // A lambda would not inherit the target, so the loads are spelled out
+        for (; i + 4 <= n; i += 4) {
+            auto v = _mm256_or_si256(
+                    _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)),
+                                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i))),
+                    _mm256_or_si256(_mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(c + i)),
+                                                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(d + i))),
+                                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(e + i))));
+            auto f = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(free + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(seeds + i), _mm256_and_si256(v, f));
+        }
+        dilateRowScalar(seeds + i, a + i, b + i, c + i, d + i, e + i, free + i, n - i);
+    }
+
+    AOC_TARGET("avx512f")
+    void dilateRowAvx512(uint64_t *seeds, const uint64_t *a, const uint64_t *b, const uint64_t *c, const uint64_t *d,
+                         const uint64_t *e, const uint64_t *free, size_t n) noexcept {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            // 0xfe is a | b | c, so two ternary ops take the place of four ors
+            auto v = _mm512_ternarylogic_epi64(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i),
+                                               _mm512_loadu_si512(c + i), 0xfe);
+            v = _mm512_ternarylogic_epi64(v, _mm512_loadu_si512(d + i), _mm512_loadu_si512(e + i), 0xfe);
+            _mm512_storeu_si512(seeds + i, _mm512_and_si512(v, _mm512_loadu_si512(free + i)));
+        }
+        dilateRowScalar(seeds + i, a + i, b + i, c + i, d + i, e + i, free + i, n - i);
+    }
+
+    aoc::cpu::Kernel<decltype(&dilateRowScalar)> dilateRow("day18 dilateRow", dilateRowScalar, nullptr,
+                                                           dilateRowAvx2, dilateRowAvx512);
+#else
+    aoc::cpu::Kernel<decltype(&dilateRowScalar)> dilateRow("day18 dilateRow", dilateRowScalar);
+#endif
+}
+
+VoxelGrid VoxelGrid::floodBitwise(size_t threads) const {
+    auto free = complement();
+    VoxelGrid air(originX, originY, originZ, width, height, depth);
+    if (words.empty()) {
+        return air;
+    }
+
+    // Every voxel of the padding is exterior air, but seeding the corner is enough
+    air.set(0, 0, 0);
+
+    const std::vector<uint64_t> empty(wordsPerRow);
+
+    // Grows the air in row (y, z) from itself and its four neighbouring rows, then spreads it
+    // along the row through every run of free voxels it reaches
+    auto relaxRow = [&](std::vector<uint64_t> &seeds, size_t y, size_t z) {
+        auto *current = air.row(y, z);
+        const auto *f = free.row(y, z);
+        dilateRow(seeds.data(), current,
+                  y > 0 ? air.row(y - 1, z) : empty.data(), y + 1 < height ? air.row(y + 1, z) : empty.data(),
+                  z > 0 ? air.row(y, z - 1) : empty.data(), z + 1 < depth ? air.row(y, z + 1) : empty.data(),
+                  f, wordsPerRow);
+
+        for (size_t i = 0; i < wordsPerRow; i++) {
+            auto carry = i > 0 ? seeds[i - 1] >> 63 : 0;
+            seeds[i] = fillUp(seeds[i] | (carry & f[i]), f[i]);
+        }
+        for (size_t i = wordsPerRow; i-- > 0;) {
+            auto carry = i + 1 < wordsPerRow ? seeds[i + 1] << 63 : 0;
+            seeds[i] = fillDown(seeds[i] | (carry & f[i]), f[i]);
+        }
+
+        if (std::equal(seeds.begin(), seeds.end(), current)) {
+            return false;
+        }
+        std::copy(seeds.begin(), seeds.end(), current);
+        return true;
+    };
+
+    // A slab only needs revisiting once it or one of its neighbours has changed since it was
+    // last relaxed, so the sweeps skip over the parts of the volume that have converged. The
+    // flags are bytes rather than bits so neighbouring workers never write the same word.
+    std::vector<uint8_t> dirty(depth, true);
+    auto relaxSlab = [&](std::vector<uint64_t> &seeds, size_t z) {
+        if (!dirty[z]) {
+            return false;
+        }
+        dirty[z] = false;
+        bool changed = false;
+        for (size_t y = 0; y < height; y++) {
+            changed |= relaxRow(seeds, y, z);
+        }
+        for (size_t y = height; y-- > 0;) {
+            changed |= relaxRow(seeds, y, z);
+        }
+        if (changed) {
+            dirty[z] = true;
+            if (z > 0) dirty[z - 1] = true;
+            if (z + 1 < depth) dirty[z + 1] = true;
+        }
+        return changed;
+    };
+
+    // Sweeps the slabs in [zBegin, zEnd) up and down until none of them change
+    auto relaxChunk = [&](size_t zBegin, size_t zEnd) {
+        std::vector<uint64_t> seeds(wordsPerRow);
+        bool changedAny = false;
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (size_t z = zBegin; z < zEnd; z++) {
+                changed |= relaxSlab(seeds, z);
+            }
+            for (size_t z = zEnd; z-- > zBegin;) {
+                changed |= relaxSlab(seeds, z);
+            }
+            changedAny |= changed;
+        }
+        return changedAny;
+    };
+
+    // The slabs are split into chunks of at least two slabs and the even and odd chunks are
+    // relaxed in alternate phases, so two workers never touch neighbouring slabs at once.
+    // Repeat until a whole round leaves every chunk unchanged.
+    auto chunks = std::max<size_t>(1, std::min(2 * threads, depth / 2));
+    auto chunkBegin = [&](size_t chunk) { return depth * chunk / chunks; };
+    for (bool changed = true; changed;) {
+        AOC_COUNT("flood rounds", 1);
+        changed = false;
+        for (size_t phase = 0; phase < 2; phase++) {
+            auto phaseChunks = (chunks + 1 - phase) / 2;
+            changed |= parallelReduce(phaseChunks, threads, [&](size_t begin, size_t end) {
+                size_t changedChunks = 0;
+                for (auto i = begin; i < end; i++) {
+                    auto chunk = 2 * i + phase;
+                    changedChunks += relaxChunk(chunkBegin(chunk), chunkBegin(chunk + 1));
+                }
+                return changedChunks;
+            }) > 0;
+        }
+    }
+    return air;
+}
+
+size_t VoxelGrid::exteriorSurfaceArea(FloodEngine engine, size_t threads) const {
+    if (engine == FloodEngine::Bitwise) {
+        return facesTouching(floodBitwise(threads), threads);
+    }
+    size_t faces;
+    floodQueue(faces);
+    return faces;
+}
+
+VoxelGrid VoxelGrid::complement() const {
+    VoxelGrid result(originX, originY, originZ, width, height, depth);
+    auto tail = width % 64 == 0 ? ~uint64_t(0) : (uint64_t(1) << (width % 64)) - 1;
+    for (size_t i = 0; i < words.size(); i++) {
+        result.words[i] = ~words[i];
+        if (i % wordsPerRow == wordsPerRow - 1) {
+            result.words[i] &= tail;
+        }
+    }
+    return result;
+}
+
+VoxelGrid VoxelGrid::exteriorAir(FloodEngine engine, size_t threads) const {
+    if (engine == FloodEngine::Bitwise) {
+        return floodBitwise(threads);
+    }
+    size_t faces;
+    return floodQueue(faces);
+}
+
+VoxelGrid VoxelGrid::airPockets(FloodEngine engine, size_t threads) const {
+    auto pockets = complement();
+    auto exterior = exteriorAir(engine, threads);
+    for (size_t i = 0; i < words.size(); i++) {
+        pockets.words[i] &= ~exterior.words[i];
+    }
+    return pockets;
+}
+
+size_t VoxelGrid::facesTouching(const VoxelGrid &other, size_t threads) const {
+    return parallelReduce(depth, threads, [&](size_t zBegin, size_t zEnd) {
+        size_t faces = 0;
+        for (size_t z = zBegin; z < zEnd; z++) {
+            for (size_t y = 0; y < height; y++) {
+                faces += touchingFaces(row(y, z), other.row(y, z),
+                                       y > 0 ? other.row(y - 1, z) : nullptr,
+                                       y + 1 < height ? other.row(y + 1, z) : nullptr,
+                                       z > 0 ? other.row(y, z - 1) : nullptr,
+                                       z + 1 < depth ? other.row(y, z + 1) : nullptr, wordsPerRow);
+            }
+        }
+        return faces;
+    });
+}
+
+std::pmr::set<Cube> findAirPockets(const std::pmr::set<Cube>& cubes) {
+    Cube min{UINT32_MAX, UINT32_MAX, UINT32_MAX};
+    Cube max{0, 0, 0};
+    for (const auto& cube : cubes) {
+        min = minCube(min, cube);
+        max = maxCube(max, cube);
+    }
+
+    // Construct the negative of the droplet, this is the set of all air bubbles and the surrounding air
+    std::pmr::set<Cube> negative(cubes.get_allocator());
+    for (auto z = min.z; z <= max.z; z++) {
+        for (auto y = min.y; y <= max.y; y++) {
+            for (auto x = min.x; x <= max.x; x++) {
+                if (!cubes.contains({x, y, z})) {
+                    negative.insert({x, y, z});
+                }
+            }
+        }
+    }
+
+    // Create a subset of the negative which are all the points on the edge of the bounding box
+    std::pmr::set<Cube> unvisitedNegativeCubes(cubes.get_allocator());
+
+    xyPlane(min, max, [&](uint32_t x, uint32_t y) {
+        auto minCube = Cube{x, y, min.z};
+        auto maxCube = Cube{x, y, max.z};
+        if (negative.contains(minCube)) unvisitedNegativeCubes.insert(minCube);
+        if (negative.contains(maxCube)) unvisitedNegativeCubes.insert(maxCube);
+    });
+    xzPlane(min, max, [&](uint32_t x, uint32_t z) {
+        auto minCube = Cube{x, min.y, z};
+        auto maxCube = Cube{x, max.y, z};
+        if (negative.contains(minCube)) unvisitedNegativeCubes.insert(minCube);
+        if (negative.contains(maxCube)) unvisitedNegativeCubes.insert(maxCube);
+    });
+    yzPlane(min, max, [&](uint32_t y, uint32_t z) {
+        auto minCube = Cube{min.x, y, z};
+        auto maxCube = Cube{max.x, y, z};
+        if (negative.contains(minCube)) unvisitedNegativeCubes.insert(minCube);
+        if (negative.contains(maxCube)) unvisitedNegativeCubes.insert(maxCube);
+    });
+
+    // For each element in the unvisited set, add all its neighbours that are in the negative
+    // to the unvisited set and remove the element from the negative and the unvisited set
+    while (!unvisitedNegativeCubes.empty()) {
+        auto it = std::min_element(unvisitedNegativeCubes.begin(), unvisitedNegativeCubes.end());
+        auto cube = *it;
+        unvisitedNegativeCubes.erase(it);
+        negative.erase(cube);
+
+        auto [x, y, z] = cube;
+        if (negative.contains({x - 1, y, z})) unvisitedNegativeCubes.insert({x - 1, y, z});
+        if (negative.contains({x + 1, y, z})) unvisitedNegativeCubes.insert({x + 1, y, z});
+        if (negative.contains({x, y - 1, z})) unvisitedNegativeCubes.insert({x, y - 1, z});
+        if (negative.contains({x, y + 1, z})) unvisitedNegativeCubes.insert({x, y + 1, z});
+        if (negative.contains({x, y, z - 1})) unvisitedNegativeCubes.insert({x, y, z - 1});
+        if (negative.contains({x, y, z + 1})) unvisitedNegativeCubes.insert({x, y, z + 1});
+    }
+
+    // The remaining points in the negative are the air pockets
+    return negative;
+}
+
+std::vector<Component> VoxelGrid::components() const {
+    constexpr uint32_t Unlabelled = 0;
+    // Provisional label equivalences, label 0 is reserved for unset voxels
+    std::vector<uint32_t> parent{Unlabelled};
+    auto find = [&](uint32_t label) {
+        while (parent[label] != label) {
+            parent[label] = parent[parent[label]];
+            label = parent[label];
+        }
+        return label;
+    };
+    auto unite = [&](uint32_t a, uint32_t b) {
+        a = find(a);
+        b = find(b);
+        if (a < b) {
+            parent[b] = a;
+        } else if (b < a) {
+            parent[a] = b;
+        }
+        return std::min(a, b);
+    };
+
+    std::vector<uint32_t> labels(width * height * depth, Unlabelled);
+    auto index = [&](size_t x, size_t y, size_t z) { return (z * height + y) * width + x; };
+
+    for (size_t z = 0; z < depth; z++) {
+        for (size_t y = 0; y < height; y++) {
+            for (size_t x = 0; x < width; x++) {
+                if (!test(x, y, z)) {
+                    continue;
+                }
+                auto label = Unlabelled;
+                for (auto neighbour: {x > 0 ? labels[index(x - 1, y, z)] : Unlabelled,
+                                      y > 0 ? labels[index(x, y - 1, z)] : Unlabelled,
+                                      z > 0 ? labels[index(x, y, z - 1)] : Unlabelled}) {
+                    if (neighbour != Unlabelled) {
+                        label = label == Unlabelled ? find(neighbour) : unite(label, neighbour);
+                    }
+                }
+                if (label == Unlabelled) {
+                    label = (uint32_t) parent.size();
+                    parent.push_back(label);
+                }
+                labels[index(x, y, z)] = label;
+            }
+        }
+    }
+
+    // Number the resolved labels in scan order of their first voxel
+    std::vector<uint32_t> componentOf(parent.size(), UINT32_MAX);
+    std::vector<Component> components;
+    for (size_t z = 0; z < depth; z++) {
+        for (size_t y = 0; y < height; y++) {
+            for (size_t x = 0; x < width; x++) {
+                auto label = labels[index(x, y, z)];
+                if (label == Unlabelled) {
+                    continue;
+                }
+                auto &id = componentOf[find(label)];
+                if (id == UINT32_MAX) {
+                    id = (uint32_t) components.size();
+                    components.emplace_back();
+                }
+
+                // Neighbouring set voxels always belong to the same component
+                auto &component = components[id];
+                size_t neighbours = (x > 0 && test(x - 1, y, z)) + (x + 1 < width && test(x + 1, y, z))
+                                    + (y > 0 && test(x, y - 1, z)) + (y + 1 < height && test(x, y + 1, z))
+                                    + (z > 0 && test(x, y, z - 1)) + (z + 1 < depth && test(x, y, z + 1));
+                auto cube = toCube(x, y, z);
+                component.volume++;
+                component.surfaceArea += 6 - neighbours;
+                component.min = minCube(component.min, cube);
+                component.max = maxCube(component.max, cube);
+            }
+        }
+    }
+    return components;
+}
+
+/**
+ * Meshes the faces of the droplet that touch exterior air. For each of the six face
+ * directions every plane of faces is covered greedily with rectangles: grow along u as
+ * far as the faces continue, then along v while the whole span continues, and clear what
+ * was covered. Returns the number of voxel faces covered, which is the exterior area.
+ */
+size_t writeExteriorMesh(const VoxelGrid &droplet, const VoxelGrid &exterior, MeshWriter &writer) {
+    const std::array<size_t, 3> size{droplet.sizeX(), droplet.sizeY(), droplet.sizeZ()};
+    std::vector<uint8_t> mask;
+    size_t faces = 0;
+
+    for (size_t axis = 0; axis < 3; axis++) {
+        // u and v follow the axis cyclically so that u x v points along +axis
+        auto uAxis = (axis + 1) % 3;
+        auto vAxis = (axis + 2) % 3;
+        auto width = size[uAxis];
+        auto height = size[vAxis];
+        mask.resize(width * height);
+
+        for (int direction: {-1, 1}) {
+            for (size_t plane = 0; plane < size[axis]; plane++) {
+                std::array<size_t, 3> voxel{};
+                voxel[axis] = plane;
+                for (size_t v = 0; v < height; v++) {
+                    for (size_t u = 0; u < width; u++) {
+                        voxel[uAxis] = u;
+                        voxel[vAxis] = v;
+                        auto air = voxel;
+                        air[axis] += direction;
+                        // The padding keeps the neighbours of every droplet voxel in bounds
+                        mask[v * width + u] = droplet.test(voxel[0], voxel[1], voxel[2])
+                                              && exterior.test(air[0], air[1], air[2]);
+                    }
+                }
+
+                for (size_t v = 0; v < height; v++) {
+                    for (size_t u = 0; u < width; u++) {
+                        if (!mask[v * width + u]) {
+                            continue;
+                        }
+                        size_t du = 1;
+                        while (u + du < width && mask[v * width + u + du]) {
+                            du++;
+                        }
+                        size_t dv = 1;
+                        while (v + dv < height && std::all_of(mask.begin() + (v + dv) * width + u,
+                                                              mask.begin() + (v + dv) * width + u + du,
+                                                              [](uint8_t m) { return m != 0; })) {
+                            dv++;
+                        }
+                        for (size_t row = v; row < v + dv; row++) {
+                            std::fill_n(mask.begin() + row * width + u, du, 0);
+                        }
+                        faces += du * dv;
+
+                        voxel[uAxis] = u;
+                        voxel[vAxis] = v;
+                        auto origin = droplet.toCube(voxel[0], voxel[1], voxel[2]);
+                        std::array<uint32_t, 3> p0{origin.x, origin.y, origin.z};
+                        if (direction > 0) {
+                            p0[axis]++;
+                        }
+                        auto p1 = p0, p2 = p0, p3 = p0;
+                        p1[uAxis] += du;
+                        p2[uAxis] += du;
+                        p2[vAxis] += dv;
+                        p3[vAxis] += dv;
+                        if (direction > 0) {
+                            writer.quad({p0, p1, p2, p3});
+                        } else {
+                            writer.quad({p0, p3, p2, p1});
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return faces;
+}
+
+size_t SparseVoxels::surfaceArea() const noexcept {
+    // Bits whose +x neighbour is in the same brick, and the bits on the x = 0 face
+    constexpr uint64_t NotLastX = 0x7f7f7f7f7f7f7f7fULL;
+    constexpr uint64_t FirstX = 0x0101010101010101ULL;
+
+    size_t shared = 0;
+    for (const auto &brick: bricks) {
+        const auto *right = find(brick.x + 1, brick.y, brick.z);
+        const auto *up = find(brick.x, brick.y + 1, brick.z);
+        const auto *above = find(brick.x, brick.y, brick.z + 1);
+        for (size_t k = 0; k < 8; k++) {
+            auto w = brick.bits[k];
+            shared += std::popcount(w & (w >> 1) & NotLastX);
+            shared += std::popcount(w & (w >> 8));
+            if (k < 7) shared += std::popcount(w & brick.bits[k + 1]);
+            if (right) shared += std::popcount((w >> 7) & FirstX & right->bits[k]);
+            if (up) shared += std::popcount((w >> 56) & up->bits[k] & 0xff);
+        }
+        if (above) shared += std::popcount(brick.bits[7] & above->bits[0]);
+    }
+    return 6 * voxels - 2 * shared;
+}
+
+std::array<Cube, 6> faceNeighbours(const Cube &c) noexcept {
+    return {Cube{c.x - 1, c.y, c.z}, Cube{c.x + 1, c.y, c.z},
+            Cube{c.x, c.y - 1, c.z}, Cube{c.x, c.y + 1, c.z},
+            Cube{c.x, c.y, c.z - 1}, Cube{c.x, c.y, c.z + 1}};
+}
+
+/**
+ * Collects the air connected to start into component, without expanding past air that
+ * sees out of the droplet. Returns true if any of it did, meaning the air is exterior.
+ */
+bool floodAir(const SparseVoxels &lava, const RowExtents &extents, const Cube &start, SparseVoxels &component) {
+    SparseVoxels::Cursor solid(lava);
+    std::vector<Cube> queue{start};
+    bool escapes = false;
+    component.insert(start);
+    while (!queue.empty()) {
+        auto air = queue.back();
+        queue.pop_back();
+        if (extents.seesOut(air)) {
+            escapes = true;
+            continue;
+        }
+        for (const auto &next: faceNeighbours(air)) {
+            if (!solid.contains(next) && component.insert(next)) {
+                queue.push_back(next);
+            }
+        }
+    }
+    return escapes;
+}
+
+size_t SparseVoxels::exteriorSurfaceArea() const {
+    RowExtents extents;
+    forEach([&](const Cube &c) { extents.add(c); });
+
+    SparseVoxels exterior;
+    SparseVoxels enclosed;
+    Cursor lava(*this);
+    size_t faces = 0;
+
+    forEach([&](const Cube &cube) {
+        for (const auto &start: faceNeighbours(cube)) {
+            if (lava.contains(start) || enclosed.contains(start)) {
+                continue;
+            }
+            if (exterior.contains(start)) {
+                faces++;
+                continue;
+            }
+
+            SparseVoxels component;
+            auto escapes = floodAir(*this, extents, start, component);
+            AOC_COUNT("air components flooded", 1);
+            auto &target = escapes ? exterior : enclosed;
+            component.forEach([&](const Cube &air) { target.insert(air); });
+            faces += escapes;
+        }
+    });
+    return faces;
+}
+
+IncrementalDroplet::LocalAir IncrementalDroplet::localAir(const Cube &centre) const {
+    // Local air, indexed by (dx + 1) + 3 * (dy + 1) + 9 * (dz + 1)
+    std::array<bool, 27> air{};
+    for (int dz = -1; dz <= 1; dz++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                Cube c{centre.x + dx, centre.y + dy, centre.z + dz};
+                air[(dx + 1) + 3 * (dy + 1) + 9 * (dz + 1)] = !lava.contains(c);
+            }
+        }
+    }
+    air[13] = false;
+
+    // In the same order as faceNeighbours
+    constexpr std::array<int, 6> Faces{12, 14, 10, 16, 4, 22};
+    auto neighbours = faceNeighbours(centre);
+    LocalAir result;
+    std::array<bool, 27> seen{};
+    std::array<int, 27> queue{};
+    for (size_t f = 0; f < Faces.size(); f++) {
+        auto face = Faces[f];
+        if (!air[face] || seen[face]) {
+            continue;
+        }
+        result.sides[result.count++] = neighbours[f];
+
+        size_t head = 0;
+        size_t tail = 0;
+        queue[tail++] = face;
+        seen[face] = true;
+        while (head < tail) {
+            auto i = queue[head++];
+            int x = i % 3, y = (i / 3) % 3, z = i / 9;
+            for (auto [dx, dy, dz]: {std::tuple{-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}}) {
+                int nx = x + dx, ny = y + dy, nz = z + dz;
+                if (nx < 0 || nx > 2 || ny < 0 || ny > 2 || nz < 0 || nz > 2) {
+                    continue;
+                }
+                auto j = nx + 3 * ny + 9 * nz;
+                if (air[j] && !seen[j]) {
+                    seen[j] = true;
+                    queue[tail++] = j;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<SparseVoxels> IncrementalDroplet::cutOff(const LocalAir &air) const {
+    enum class State { Running, Escaped, Exhausted };
+    struct Side {
+        SparseVoxels cells;
+        std::vector<Cube> queue;
+        size_t head = 0;
+        size_t root = 0;
+        State state = State::Running;
+    };
+
+    std::vector<Side> sides(air.count);
+    for (size_t i = 0; i < air.count; i++) {
+        sides[i].cells.insert(air.sides[i]);
+        sides[i].queue.push_back(air.sides[i]);
+        sides[i].root = i;
+    }
+    auto rootOf = [&](size_t i) {
+        while (sides[i].root != i) {
+            i = sides[i].root;
+        }
+        return i;
+    };
+    size_t running = air.count;
+    size_t escaped = 0;
+    auto stop = [&](Side &side, State state) {
+        side.state = state;
+        running--;
+        escaped += state == State::Escaped;
+    };
+
+    SparseVoxels::Cursor solid(lava);
+    // A lone side still running when nothing has escaped is where the rest of the air went
+    while (running > 1 || (running == 1 && escaped > 0)) {
+        for (size_t i = 0; i < sides.size() && (running > 1 || (running == 1 && escaped > 0)); i++) {
+            auto &side = sides[i];
+            if (side.root != i || side.state != State::Running) {
+                continue;
+            }
+            if (side.head == side.queue.size()) {
+                stop(side, State::Exhausted);
+                continue;
+            }
+            auto cell = side.queue[side.head++];
+            if (extents.seesOut(cell)) {
+                stop(side, State::Escaped);
+                continue;
+            }
+            AOC_COUNT("air cells reflooded", 1);
+            for (const auto &next: faceNeighbours(cell)) {
+                if (solid.contains(next) || side.cells.contains(next)) {
+                    continue;
+                }
+                auto owner = sides.size();
+                for (size_t j = 0; j < sides.size(); j++) {
+                    if (j != i && sides[j].cells.contains(next)) {
+                        owner = rootOf(j);
+                        break;
+                    }
+                }
+                if (owner == sides.size()) {
+                    side.cells.insert(next);
+                    side.queue.push_back(next);
+                } else if (owner != i && side.state == State::Running) {
+                    if (sides[owner].state == State::Escaped) {
+                        // Reached air already known to be exterior
+                        stop(side, State::Escaped);
+                    } else if (sides[owner].state == State::Running) {
+                        // Two sides are connected after all, so the other carries on as part of this one
+                        auto &other = sides[owner];
+                        side.queue.insert(side.queue.end(), other.queue.begin() + ptrdiff_t(other.head),
+                                          other.queue.end());
+                        other.root = i;
+                        running--;
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<SparseVoxels> result;
+    for (size_t i = 0; i < sides.size(); i++) {
+        if (sides[i].root != i || sides[i].state != State::Exhausted) {
+            continue;
+        }
+        SparseVoxels cells;
+        for (size_t j = 0; j < sides.size(); j++) {
+            if (rootOf(j) == i) {
+                sides[j].cells.forEach([&](const Cube &c) { cells.insert(c); });
+            }
+        }
+        result.push_back(std::move(cells));
+    }
+    return result;
+}
+
+uint32_t IncrementalDroplet::newPocket() {
+    if (freePockets.empty()) {
+        pockets.emplace_back();
+        return uint32_t(pockets.size() - 1);
+    }
+    auto pocket = freePockets.back();
+    freePockets.pop_back();
+    return pocket;
+}
+
+void IncrementalDroplet::enclose(const SparseVoxels &air) {
+    auto pocket = newPocket();
+    air.forEach([&](const Cube &c) {
+        pockets[pocket].insert(c);
+        pocketOf[c] = pocket;
+        pocketFaces += countNeighbours(lava, c);
+    });
+}
+
+uint32_t IncrementalDroplet::merge(uint32_t a, uint32_t b) {
+    if (a == b) {
+        return a;
+    }
+    if (pockets[a].size() < pockets[b].size()) {
+        std::swap(a, b);
+    }
+    pockets[b].forEach([&](const Cube &c) {
+        pockets[a].insert(c);
+        pocketOf[c] = a;
+    });
+    pockets[b] = SparseVoxels();
+    freePockets.push_back(b);
+    return a;
+}
+
+void IncrementalDroplet::release(uint32_t pocket) {
+    pockets[pocket].forEach([&](const Cube &c) {
+        pocketOf.erase(c);
+        pocketFaces -= countNeighbours(lava, c);
+    });
+    pockets[pocket] = SparseVoxels();
+    freePockets.push_back(pocket);
+}
+
+bool IncrementalDroplet::insert(const Cube &cube) {
+    if (!lava.insert(cube)) {
+        return false;
+    }
+    extents.add(cube);
+    auto neighbours = countNeighbours(lava, cube);
+    area = area + 6 - 2 * neighbours;
+
+    if (auto it = pocketOf.find(cube); it != pocketOf.end()) {
+        // Filling part of a pocket: its faces against the lava go and it gains faces against
+        // the rest of the pocket, which stays enclosed however it is split
+        auto pocket = it->second;
+        pocketOf.erase(it);
+        pockets[pocket].erase(cube);
+        pocketFaces = pocketFaces - neighbours + countEnclosed(cube);
+        if (pockets[pocket].size() == 0) {
+            pockets[pocket] = SparseVoxels();
+            freePockets.push_back(pocket);
+            return true;
+        }
+        // Each part the cube cut off the pocket gets a number of its own
+        if (auto air = localAir(cube); air.count > 1) {
+            for (const auto &part: cutOff(air)) {
+                auto split = newPocket();
+                part.forEach([&](const Cube &c) {
+                    pockets[pocket].erase(c);
+                    pockets[split].insert(c);
+                    pocketOf[c] = split;
+                });
+            }
+        }
+        return true;
+    }
+
+    // The cube displaced exterior air, which may now be cut off from the outside
+    if (auto air = localAir(cube); air.count > 1) {
+        for (const auto &pocket: cutOff(air)) {
+            enclose(pocket);
+        }
+    }
+    return true;
+}
+
+bool IncrementalDroplet::erase(const Cube &cube) {
+    if (!lava.erase(cube)) {
+        return false;
+    }
+    auto neighbours = countNeighbours(lava, cube);
+    area = area + 2 * neighbours - 6;
+    // The faces the cube shared with pockets are gone
+    pocketFaces -= countEnclosed(cube);
+
+    bool touchesExterior = false;
+    std::array<uint32_t, 6> around{};
+    size_t count = 0;
+    for (const auto &c: faceNeighbours(cube)) {
+        if (auto it = pocketOf.find(c); it != pocketOf.end()) {
+            auto end = around.begin() + ptrdiff_t(count);
+            if (std::find(around.begin(), end, it->second) == end) {
+                around[count++] = it->second;
+            }
+        } else if (!lava.contains(c)) {
+            touchesExterior = true;
+        }
+    }
+
+    if (touchesExterior) {
+        // The new air joins the exterior and opens every pocket it touches
+        for (size_t i = 0; i < count; i++) {
+            release(around[i]);
+        }
+        return true;
+    }
+    // The new air joins the pockets around it into one, or forms one of its own
+    auto pocket = count == 0 ? newPocket() : around[0];
+    for (size_t i = 1; i < count; i++) {
+        pocket = merge(pocket, around[i]);
+    }
+    pockets[pocket].insert(cube);
+    pocketOf[cube] = pocket;
+    pocketFaces += neighbours;
+    return true;
+}
+
+void IncrementalDroplet::verify() const {
+    auto expectedArea = lava.surfaceArea();
+    auto expectedExterior = lava.exteriorSurfaceArea();
+    if (expectedArea != area || expectedExterior != exteriorSurfaceArea()) {
+        throw std::runtime_error(std::format("Incremental areas {} and {} disagree with recomputed {} and {}",
+                                             area, exteriorSurfaceArea(), expectedArea, expectedExterior));
+    }
+
+    // Every pocket is closed: the air next to any of its cells belongs to it and no other
+    size_t cells = 0;
+    for (uint32_t pocket = 0; pocket < pockets.size(); pocket++) {
+        cells += pockets[pocket].size();
+        pockets[pocket].forEach([&](const Cube &c) {
+            for (const auto &next: faceNeighbours(c)) {
+                auto it = pocketOf.find(next);
+                if (!lava.contains(next) && (it == pocketOf.end() || it->second != pocket)) {
+                    throw std::runtime_error(std::format("Air at {},{},{} is next to pocket {} but not part of it",
+                                                         next.x, next.y, next.z, pocket));
+                }
+            }
+        });
+    }
+    if (cells != pocketOf.size()) {
+        throw std::runtime_error(std::format("The pockets hold {} cells but {} are labelled", cells, pocketOf.size()));
+    }
+}
+
+namespace {
+    uint32_t parseCoordinate(const char *&p, const char *end) {
+        auto [n, length] = aoc::parseIntegerSwar<uint32_t>(std::string_view(p, end - p));
+        p += length;
+        return n;
+    }
+
+    void expect(const char *&p, const char *end, char c) {
+        if (p == end || *p != c) {
+            throw std::runtime_error(std::format("Expected '{}' in voxel list", c));
+        }
+        p++;
+    }
+
+    void ingestChunk(std::string_view text, std::vector<Cube> &cubes) {
+        const char *p = text.data();
+        const char *end = p + text.size();
+        while (p < end) {
+            if (*p == '\n' || *p == '\r') {
+                p++;
+                continue;
+            }
+            auto x = parseCoordinate(p, end);
+            expect(p, end, ',');
+            auto y = parseCoordinate(p, end);
+            expect(p, end, ',');
+            auto z = parseCoordinate(p, end);
+            cubes.push_back({x, y, z});
+        }
+    }
+}
+
+/**
+ * Decodes a whole "x,y,z" per line voxel list without allocating per line. With more than
+ * one thread the text is cut into chunks at newlines which are decoded concurrently.
+ */
+std::vector<Cube> ingest(std::string_view text, size_t threads) {
+    AOC_PHASE("parse");
+    // Not worth starting threads for less than this many bytes each
+    constexpr size_t MinimumChunk = 1 << 20;
+    threads = std::clamp<size_t>(text.size() / MinimumChunk, 1, threads);
+
+    std::vector<std::string_view> chunks;
+    for (size_t t = 0, begin = 0; t < threads && begin < text.size(); t++) {
+        auto end = t + 1 == threads ? text.size() : text.find('\n', text.size() * (t + 1) / threads);
+        end = std::min(end == std::string_view::npos ? text.size() : end + 1, text.size());
+        if (end > begin) {
+            chunks.push_back(text.substr(begin, end - begin));
+        }
+        begin = end;
+    }
+
+    // Lines are at least six bytes long, which bounds each chunk's output up front
+    std::vector<std::vector<Cube>> parts(chunks.size());
+    parallelReduce(chunks.size(), threads, [&](size_t begin, size_t end) {
+        for (auto i = begin; i < end; i++) {
+            parts[i].reserve(chunks[i].size() / 6 + 1);
+            ingestChunk(chunks[i], parts[i]);
+        }
+        return size_t(0);
+    });
+
+    if (parts.size() == 1) {
+        return std::move(parts.front());
+    }
+    std::vector<Cube> cubes;
+    cubes.reserve(std::transform_reduce(parts.begin(), parts.end(), size_t(0), std::plus(),
+                                        [](const auto &part) { return part.size(); }));
+    for (const auto &part: parts) {
+        cubes.insert(cubes.end(), part.begin(), part.end());
+    }
+    return cubes;
+}
+
+std::string packCubes(const std::vector<Cube> &cubes) {
+    aoc::Packer packer;
+    packer.putArray(std::span(cubes));
+    return packer.take();
+}
+
+std::vector<Cube> unpackCubes(std::string_view packed) {
+    aoc::Unpacker unpacker(packed);
+    auto cubes = unpacker.getArray<Cube>();
+    if (!unpacker.done()) {
+        throw std::runtime_error("Corrupt cache entry");
+    }
+    return cubes;
+}
+
+namespace {
+    // Writes the mesh of the grid's exterior, which must cover exactly the exterior area found
+    void writeMesh(const VoxelGrid &grid, const Options &options, size_t exteriorArea) {
+        AOC_PHASE("mesh");
+        MeshWriter writer(options.meshPath);
+        auto faces = writeExteriorMesh(grid, grid.exteriorAir(options.engine, options.threads), writer);
+        writer.finish();
+        if (faces != exteriorArea) {
+            throw std::runtime_error(std::format("Mesh covers {} faces but the exterior area is {}",
+                                                 faces, exteriorArea));
+        }
+    }
+
+    /**
+     * The mesh and the pockets are found on a dense grid, which the engines without one of
+     * their own build for them. Checked before solving, so a droplet too spread out for that
+     * grid fails at once rather than after the areas, or by running out of memory.
+     */
+    template <typename Cubes>
+    void requireDenseGrid(const Cubes &cubes, const Options &options) {
+        if ((options.meshPath.empty() && !options.pockets) || !SparseVoxels::preferredFor(cubes)) {
+            return;
+        }
+        throw std::runtime_error(std::format("The {} need{} a dense grid, and the droplet is too spread out for one",
+                                             options.pockets ? "pockets" : "mesh", options.pockets ? "" : "s"));
+    }
+
+    Result solveWithSets(const std::pmr::set<Cube> &cubes, const Options &options) {
+        requireDenseGrid(cubes, options);
+        Result result;
+        {
+            AOC_PHASE("solve");
+            result.part1 = surfaceArea(cubes);
+            result.part2 = result.part1 - surfaceArea(findAirPockets(cubes));
+        }
+        if (!options.meshPath.empty() || options.pockets) {
+            auto grid = VoxelGrid::fromCubes(cubes);
+            if (!options.meshPath.empty()) {
+                writeMesh(grid, options, result.part2);
+            }
+            if (options.pockets) {
+                AOC_PHASE("pockets");
+                result.pockets = grid.airPockets(options.engine, options.threads).components();
+            }
+        }
+        return result;
+    }
+}
+
+Result solve(const std::vector<Cube> &cubes, const Options &options) {
+    if (options.useSets) {
+        return solveWithSets(std::pmr::set<Cube>(cubes.begin(), cubes.end(), options.memory), options);
+    }
+
+    bool sparse = options.storage == Storage::Sparse
+                  || (options.storage == Storage::Auto && SparseVoxels::preferredFor(cubes));
+    if (options.incremental || sparse) {
+        requireDenseGrid(cubes, options);
+    }
+
+    Result result;
+    // Only dense storage has a grid to hand for the mesh and the pockets; the others build one
+    std::optional<VoxelGrid> grid;
+    if (options.incremental) {
+        IncrementalDroplet droplet;
+        {
+            AOC_PHASE("solve");
+            for (const auto &cube: cubes) {
+                droplet.insert(cube);
+            }
+        }
+        if (options.verify) {
+            AOC_PHASE("verify");
+            droplet.verify();
+        }
+        result.part1 = droplet.surfaceArea();
+        result.part2 = droplet.exteriorSurfaceArea();
+    } else if (sparse) {
+        SparseVoxels store;
+        {
+            AOC_PHASE("preprocess");
+            for (const auto &cube: cubes) {
+                store.insert(cube);
+            }
+        }
+        AOC_PHASE("solve");
+        result.part1 = store.surfaceArea();
+        result.part2 = store.exteriorSurfaceArea();
+    } else {
+        {
+            AOC_PHASE("preprocess");
+            grid = VoxelGrid::fromCubes(cubes);
+        }
+        AOC_PHASE("solve");
+        result.part1 = grid->surfaceArea(options.threads);
+        result.part2 = grid->exteriorSurfaceArea(options.engine, options.threads);
+    }
+
+    if (!options.meshPath.empty() || options.pockets) {
+        if (!grid) {
+            grid = VoxelGrid::fromCubes(cubes);
+        }
+        if (!options.meshPath.empty()) {
+            writeMesh(*grid, options, result.part2);
+        }
+        if (options.pockets) {
+            AOC_PHASE("pockets");
+            result.pockets = grid->airPockets(options.engine, options.threads).components();
+        }
+    }
+    return result;
+}
+
+Result solve(std::string_view input, const Options &options) {
+    if (options.useSets) {
+        return solveWithSets(parse(input, options.memory), options);
+    }
+    return solve(ingest(input, options.threads), options);
+}
+
+std::string report(const Result &result) {
+    auto text = std::format("Part 1: {}\nPart 2: {}\n", result.part1, result.part2);
+    for (const auto &pocket: result.pockets) {
+        text += std::format("Pocket of {} voxels with area {} from {},{},{} to {},{},{}\n",
+                            pocket.volume, pocket.surfaceArea,
+                            pocket.min.x, pocket.min.y, pocket.min.z,
+                            pocket.max.x, pocket.max.y, pocket.max.z);
+    }
+    return text;
+}
+
+std::string toJson(const Result &result) {
+    aoc::JsonObject json;
+    json.add("part1", result.part1).add("part2", result.part2);
+    if (!result.pockets.empty()) {
+        auto cube = [](const Cube &c) { return std::format("[{},{},{}]", c.x, c.y, c.z); };
+        std::vector<std::string> pockets;
+        for (const auto &pocket: result.pockets) {
+            pockets.push_back(aoc::JsonObject()
+                                      .add("volume", pocket.volume)
+                                      .add("surfaceArea", pocket.surfaceArea)
+                                      .addRaw("min", cube(pocket.min))
+                                      .addRaw("max", cube(pocket.max))
+                                      .str());
+        }
+        json.addRaw("pockets", aoc::jsonArray(pockets));
+    }
+    return json.str();
+}
+
+}
@@ -0,0 +1,647 @@
+//   Copyright 28/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <memory_resource>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <bit>
+
+namespace day18 {
+
+struct Cube {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t z = 0;
+
+    constexpr bool operator==(const Cube &other) const noexcept = default;
+
+    constexpr auto operator<=>(const Cube &other) const noexcept {
+        auto cmpX = x <=> other.x;
+        if (cmpX != std::strong_ordering::equal) {
+            return cmpX;
+        }
+        auto cmpY = y <=> other.y;
+        if (cmpY != std::strong_ordering::equal) {
+            return cmpY;
+        }
+        return z <=> other.z;
+    }
+};
+
+inline Cube minCube(const Cube& a, const Cube& b) noexcept {
+    return Cube{std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)};
+}
+
+inline Cube maxCube(const Cube& a, const Cube& b) noexcept {
+    return Cube{std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)};
+}
+
+/**
+ * A face-connected group of voxels, with its bounding box in droplet coordinates.
+ */
+struct Component {
+    size_t volume = 0;
+    size_t surfaceArea = 0;
+    Cube min{UINT32_MAX, UINT32_MAX, UINT32_MAX};
+    Cube max{0, 0, 0};
+};
+
+enum class FloodEngine : uint8_t {
+    // Breadth first search over single voxels
+    Queue,
+    // Iterated dilation over whole rows of voxels at a time
+    Bitwise,
+};
+
+/**
+ * A dense bit volume covering the bounding box of a droplet plus one voxel of padding on
+ * every side. Each row along x is packed into 64-bit words so whole rows can be combined
+ * with bitwise operations, and rows are laid out y-major within z slices.
+ */
+class VoxelGrid {
+    // Droplet coordinates of local voxel (0, 0, 0)
+    int64_t originX = 0;
+    int64_t originY = 0;
+    int64_t originZ = 0;
+    size_t width = 0;
+    size_t height = 0;
+    size_t depth = 0;
+    size_t wordsPerRow = 0;
+    std::vector<uint64_t> words;
+
+    // Breadth first search of the unset voxels from the corner, counting the set voxel faces it touches
+    VoxelGrid floodQueue(size_t &faces) const;
+    VoxelGrid floodBitwise(size_t threads) const;
+
+public:
+    VoxelGrid() = default;
+
+    VoxelGrid(int64_t originX, int64_t originY, int64_t originZ, size_t width, size_t height, size_t depth)
+            : originX(originX), originY(originY), originZ(originZ), width(width), height(height), depth(depth),
+              wordsPerRow((width + 63) / 64), words(wordsPerRow * height * depth) {}
+
+    // Builds the grid from any container of cubes; duplicates are harmless
+    template <typename Cubes>
+    static VoxelGrid fromCubes(const Cubes &cubes);
+
+    [[nodiscard]] size_t sizeX() const noexcept { return width; }
+    [[nodiscard]] size_t sizeY() const noexcept { return height; }
+    [[nodiscard]] size_t sizeZ() const noexcept { return depth; }
+    [[nodiscard]] size_t rowWords() const noexcept { return wordsPerRow; }
+
+    [[nodiscard]] size_t rowOffset(size_t y, size_t z) const noexcept { return (z * height + y) * wordsPerRow; }
+    [[nodiscard]] const uint64_t *row(size_t y, size_t z) const noexcept { return words.data() + rowOffset(y, z); }
+    [[nodiscard]] uint64_t *row(size_t y, size_t z) noexcept { return words.data() + rowOffset(y, z); }
+
+    [[nodiscard]] bool test(size_t x, size_t y, size_t z) const noexcept {
+        return (row(y, z)[x / 64] >> (x % 64)) & 1;
+    }
+
+    void set(size_t x, size_t y, size_t z) noexcept { row(y, z)[x / 64] |= uint64_t(1) << (x % 64); }
+
+    void reset(size_t x, size_t y, size_t z) noexcept { row(y, z)[x / 64] &= ~(uint64_t(1) << (x % 64)); }
+
+    [[nodiscard]] Cube toCube(size_t x, size_t y, size_t z) const noexcept {
+        return Cube{uint32_t(originX + int64_t(x)), uint32_t(originY + int64_t(y)), uint32_t(originZ + int64_t(z))};
+    }
+
+    [[nodiscard]] size_t count() const noexcept;
+
+    /**
+     * Every set voxel contributes six faces, less two for each pair of set voxels that share
+     * a face. The shared faces are counted a row at a time by AND-ing each row with itself
+     * shifted by one in x, and with its neighbouring rows in y and z.
+     *
+     * With more than one thread the volume is split into runs of z slabs, each worker
+     * counting the faces within its slabs and across its lower boundary.
+     */
+    [[nodiscard]] size_t surfaceArea(size_t threads = 1) const;
+
+    /**
+     * Floods the air outside the droplet from a corner of the padding, which is always
+     * exterior, and counts every droplet face the flood touches. Each exterior face is seen
+     * from exactly one air voxel, so this is the exterior surface area without ever
+     * materialising the air pockets.
+     */
+    [[nodiscard]] size_t exteriorSurfaceArea(FloodEngine engine = FloodEngine::Queue, size_t threads = 1) const;
+
+    // The unset voxels of the bounding box, with the bits past the end of each row left clear
+    [[nodiscard]] VoxelGrid complement() const;
+
+    // The unset voxels connected to the padding
+    [[nodiscard]] VoxelGrid exteriorAir(FloodEngine engine, size_t threads = 1) const;
+
+    // The unset voxels that are enclosed by the droplet
+    [[nodiscard]] VoxelGrid airPockets(FloodEngine engine, size_t threads = 1) const;
+
+    // Counts the faces of this grid's voxels that are shared with a voxel of other, which must have the same shape
+    [[nodiscard]] size_t facesTouching(const VoxelGrid &other, size_t threads = 1) const;
+
+    /**
+     * Labels the face-connected components of the set voxels with a two pass scanline: the
+     * first pass gives each voxel the smallest provisional label of its already visited
+     * neighbours and records the equivalences in a union-find table, the second resolves
+     * every label and accumulates the statistics of each component.
+     *
+     * Run it on the droplet for the lava components or on airPockets() for the pockets.
+     */
+    [[nodiscard]] std::vector<Component> components() const;
+};
+
+template <typename Cubes>
+VoxelGrid VoxelGrid::fromCubes(const Cubes &cubes) {
+    if (cubes.empty()) {
+        return {};
+    }
+    Cube min{UINT32_MAX, UINT32_MAX, UINT32_MAX};
+    Cube max{0, 0, 0};
+    for (const auto &cube: cubes) {
+        min = minCube(min, cube);
+        max = maxCube(max, cube);
+    }
+
+    VoxelGrid grid(int64_t(min.x) - 1, int64_t(min.y) - 1, int64_t(min.z) - 1,
+                   size_t(max.x - min.x) + 3, size_t(max.y - min.y) + 3, size_t(max.z - min.z) + 3);
+    for (const auto &[x, y, z]: cubes) {
+        grid.set(x - min.x + 1, y - min.y + 1, z - min.z + 1);
+    }
+    return grid;
+}
+
+std::pmr::set<Cube> parse(std::string_view input, std::pmr::memory_resource *memory = std::pmr::get_default_resource());
+
+size_t surfaceArea(const std::pmr::set<Cube> &cubes);
+
+// The air voxels inside the bounding box that cannot reach its boundary, allocated like cubes
+std::pmr::set<Cube> findAirPockets(const std::pmr::set<Cube>& cubes);
+
+/**
+ * Streams a quad mesh to a binary file laid out as
+ *
+ *   "AOCMESH1", uint64 vertex count, uint64 triangle count,
+ *   vertex count x (uint32 x, y, z), triangle count x (uint32 a, b, c)
+ *
+ * in native byte order. Quads never share vertices, so each one adds four vertices and the
+ * triangles (0, 1, 2) and (0, 2, 3) of them; the index section is generated when the file
+ * is finished and the counts patched into the header.
+ */
+class MeshWriter {
+    std::ofstream out;
+    std::vector<uint32_t> buffer;
+    uint64_t quads = 0;
+
+    void flush() {
+        out.write(reinterpret_cast<const char *>(buffer.data()), std::streamsize(buffer.size() * sizeof(uint32_t)));
+        buffer.clear();
+    }
+
+public:
+    explicit MeshWriter(const std::string &path) : out(path, std::ios::binary | std::ios::trunc) {
+        if (!out) {
+            throw std::runtime_error(std::format("Failed to open mesh file {}", path));
+        }
+        uint64_t counts[2]{};
+        out.write("AOCMESH1", 8);
+        out.write(reinterpret_cast<const char *>(counts), sizeof(counts));
+        buffer.reserve(1 << 16);
+    }
+
+    // The indices are 32 bits, so a quad past this many would wrap its vertex indices
+    static constexpr uint64_t MaxQuads = (uint64_t(UINT32_MAX) + 1) / 4;
+
+    // Adds a quad whose corners are given counter-clockwise as seen from outside
+    void quad(const std::array<std::array<uint32_t, 3>, 4> &corners) {
+        if (quads == MaxQuads) {
+            throw std::runtime_error(std::format("The mesh has more than {} quads, which 32-bit indices cannot reach",
+                                                 MaxQuads));
+        }
+        for (const auto &corner: corners) {
+            buffer.insert(buffer.end(), corner.begin(), corner.end());
+        }
+        quads++;
+        if (buffer.size() + 12 > buffer.capacity()) {
+            flush();
+        }
+    }
+
+    void finish() {
+        flush();
+        for (uint64_t q = 0; q < quads; q++) {
+            auto base = uint32_t(4 * q);
+            buffer.insert(buffer.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+            if (buffer.size() + 6 > buffer.capacity()) {
+                flush();
+            }
+        }
+        flush();
+
+        uint64_t counts[2]{4 * quads, 2 * quads};
+        out.seekp(8);
+        out.write(reinterpret_cast<const char *>(counts), sizeof(counts));
+        out.flush();
+        if (!out) {
+            throw std::runtime_error("Failed to write mesh file");
+        }
+    }
+};
+
+size_t writeExteriorMesh(const VoxelGrid &droplet, const VoxelGrid &exterior, MeshWriter &writer);
+
+/**
+ * A sparse voxel store for droplets spread over a box far too large for a dense grid. Voxels
+ * are grouped into 8x8x8 bricks, each a 512-bit mask with one word per z layer and bit
+ * y * 8 + x within it, found through an open addressing hash table keyed by brick
+ * coordinates. Neighbouring voxels share a brick seven times out of eight, so both the
+ * bulk operations and Cursor lookups touch the hash table rarely.
+ */
+class SparseVoxels {
+public:
+    struct Brick {
+        uint32_t x = 0;
+        uint32_t y = 0;
+        uint32_t z = 0;
+        std::array<uint64_t, 8> bits{};
+    };
+
+    /**
+     * Point lookups that remember the last brick they visited.
+     */
+    class Cursor {
+        const SparseVoxels &store;
+        const Brick *brick = nullptr;
+        uint32_t bx = UINT32_MAX;
+        uint32_t by = UINT32_MAX;
+        uint32_t bz = UINT32_MAX;
+
+    public:
+        explicit Cursor(const SparseVoxels &store) : store(store) {}
+
+        bool contains(const Cube &cube) {
+            if (cube.x >> 3 != bx || cube.y >> 3 != by || cube.z >> 3 != bz) {
+                bx = cube.x >> 3;
+                by = cube.y >> 3;
+                bz = cube.z >> 3;
+                brick = store.find(bx, by, bz);
+            }
+            return brick && SparseVoxels::test(*brick, cube);
+        }
+    };
+
+private:
+    static constexpr uint32_t EmptySlot = UINT32_MAX;
+
+    std::vector<Brick> bricks;
+    std::vector<uint32_t> slots = std::vector<uint32_t>(16, EmptySlot);
+    size_t voxels = 0;
+
+    static size_t hash(uint32_t bx, uint32_t by, uint32_t bz) noexcept {
+        uint64_t h = (uint64_t(bx) * 0x9e3779b97f4a7c15ULL) ^ (uint64_t(by) * 0xc2b2ae3d27d4eb4fULL)
+                     ^ (uint64_t(bz) * 0x165667b19e3779f9ULL);
+        return h ^ (h >> 29);
+    }
+
+    [[nodiscard]] size_t slotOf(uint32_t bx, uint32_t by, uint32_t bz) const noexcept {
+        auto mask = slots.size() - 1;
+        for (auto slot = hash(bx, by, bz) & mask;; slot = (slot + 1) & mask) {
+            auto index = slots[slot];
+            if (index == EmptySlot) {
+                return slot;
+            }
+            const auto &brick = bricks[index];
+            if (brick.x == bx && brick.y == by && brick.z == bz) {
+                return slot;
+            }
+        }
+    }
+
+    void rehash() {
+        std::vector<uint32_t>(slots.size() * 2, EmptySlot).swap(slots);
+        for (uint32_t index = 0; index < bricks.size(); index++) {
+            const auto &brick = bricks[index];
+            slots[slotOf(brick.x, brick.y, brick.z)] = index;
+        }
+    }
+
+    static bool test(const Brick &brick, const Cube &cube) noexcept {
+        return (brick.bits[cube.z & 7] >> ((cube.y & 7) * 8 + (cube.x & 7))) & 1;
+    }
+
+public:
+    [[nodiscard]] size_t size() const noexcept { return voxels; }
+
+    [[nodiscard]] const std::vector<Brick> &allBricks() const noexcept { return bricks; }
+
+    [[nodiscard]] const Brick *find(uint32_t bx, uint32_t by, uint32_t bz) const noexcept {
+        auto index = slots[slotOf(bx, by, bz)];
+        return index == EmptySlot ? nullptr : &bricks[index];
+    }
+
+    [[nodiscard]] bool contains(const Cube &cube) const noexcept {
+        const auto *brick = find(cube.x >> 3, cube.y >> 3, cube.z >> 3);
+        return brick && test(*brick, cube);
+    }
+
+    // Returns true if the voxel was not already present
+    bool insert(const Cube &cube) {
+        uint32_t bx = cube.x >> 3;
+        uint32_t by = cube.y >> 3;
+        uint32_t bz = cube.z >> 3;
+        auto slot = slotOf(bx, by, bz);
+        if (slots[slot] == EmptySlot) {
+            if (2 * (bricks.size() + 1) > slots.size()) {
+                rehash();
+                slot = slotOf(bx, by, bz);
+            }
+            slots[slot] = (uint32_t) bricks.size();
+            bricks.push_back({bx, by, bz, {}});
+        }
+        auto &word = bricks[slots[slot]].bits[cube.z & 7];
+        auto bit = uint64_t(1) << ((cube.y & 7) * 8 + (cube.x & 7));
+        if (word & bit) {
+            return false;
+        }
+        word |= bit;
+        voxels++;
+        return true;
+    }
+
+    // Returns true if the voxel was present. Emptied bricks are kept for reuse.
+    bool erase(const Cube &cube) noexcept {
+        auto index = slots[slotOf(cube.x >> 3, cube.y >> 3, cube.z >> 3)];
+        if (index == EmptySlot) {
+            return false;
+        }
+        auto &word = bricks[index].bits[cube.z & 7];
+        auto bit = uint64_t(1) << ((cube.y & 7) * 8 + (cube.x & 7));
+        if (!(word & bit)) {
+            return false;
+        }
+        word &= ~bit;
+        voxels--;
+        return true;
+    }
+
+    template <typename Fn>
+    void forEach(Fn &&fn) const {
+        for (const auto &brick: bricks) {
+            for (uint32_t k = 0; k < 8; k++) {
+                for (auto word = brick.bits[k]; word != 0; word &= word - 1) {
+                    auto bit = (uint32_t) std::countr_zero(word);
+                    fn(Cube{brick.x * 8 + (bit & 7), brick.y * 8 + (bit >> 3), brick.z * 8 + k});
+                }
+            }
+        }
+    }
+
+    /**
+     * As for VoxelGrid::surfaceArea, but the shared faces are found a brick at a time: inside
+     * the brick with shifts of each layer, and across its +x, +y and +z faces against the
+     * neighbouring brick, when there is one.
+     */
+    [[nodiscard]] size_t surfaceArea() const noexcept;
+
+    /**
+     * There is no bounding box to flood from, so instead the air next to the droplet is
+     * classified a component at a time. An air voxel that can see out of the droplet along
+     * any axis, because it lies beyond the extent of the droplet in its row, is certainly
+     * exterior; a flood from any other air voxel never needs to expand past those, so only
+     * the air inside the droplet's orthogonal hull is ever visited.
+     */
+    [[nodiscard]] size_t exteriorSurfaceArea() const;
+
+    /**
+     * The dense grid wins unless its bitmap would be both large and mostly empty.
+     */
+    template <typename Cubes>
+    static bool preferredFor(const Cubes &cubes);
+};
+
+template <typename Cubes>
+bool SparseVoxels::preferredFor(const Cubes &cubes) {
+    // Below this many voxels in the bounding box the dense bitmap is at most a few megabytes
+    constexpr double DenseVolumeLimit = double(1 << 24);
+    // Above this many voxels per cube, bricks holding at most 512 voxels each use less memory
+    constexpr double SparseRatio = 64.0;
+
+    if (cubes.empty()) {
+        return false;
+    }
+    Cube min{UINT32_MAX, UINT32_MAX, UINT32_MAX};
+    Cube max{0, 0, 0};
+    for (const auto &cube: cubes) {
+        min = minCube(min, cube);
+        max = maxCube(max, cube);
+    }
+    auto volume = (double(max.x - min.x) + 3) * (double(max.y - min.y) + 3) * (double(max.z - min.z) + 3);
+    return volume > DenseVolumeLimit && volume > SparseRatio * double(cubes.size());
+}
+
+std::array<Cube, 6> faceNeighbours(const Cube &c) noexcept;
+
+/**
+ * The extent of a droplet along every occupied row in x, y and z. Air beyond the extent of
+ * the droplet in any of its rows can see out along that axis, so is certainly exterior.
+ *
+ * Extents only ever grow, so after cubes are removed they are a conservative superset and
+ * seesOut stays sound.
+ */
+class RowExtents {
+    struct Extent {
+        uint32_t min = UINT32_MAX;
+        uint32_t max = 0;
+
+        void add(uint32_t v) noexcept {
+            min = std::min(min, v);
+            max = std::max(max, v);
+        }
+
+        [[nodiscard]] bool outside(uint32_t v) const noexcept { return v < min || v > max; }
+    };
+
+    std::unordered_map<uint64_t, Extent> rowsX;
+    std::unordered_map<uint64_t, Extent> rowsY;
+    std::unordered_map<uint64_t, Extent> rowsZ;
+
+    static uint64_t key(uint32_t a, uint32_t b) noexcept { return uint64_t(a) << 32 | b; }
+
+    static bool outside(const std::unordered_map<uint64_t, Extent> &rows, uint64_t k, uint32_t v) {
+        auto it = rows.find(k);
+        return it == rows.end() || it->second.outside(v);
+    }
+
+public:
+    void add(const Cube &c) {
+        rowsX[key(c.y, c.z)].add(c.x);
+        rowsY[key(c.x, c.z)].add(c.y);
+        rowsZ[key(c.x, c.y)].add(c.z);
+    }
+
+    [[nodiscard]] bool seesOut(const Cube &c) const {
+        return outside(rowsX, key(c.y, c.z), c.x) || outside(rowsY, key(c.x, c.z), c.y)
+               || outside(rowsZ, key(c.x, c.y), c.z);
+    }
+};
+
+struct CubeHash {
+    size_t operator()(const Cube &c) const noexcept {
+        uint64_t h = (uint64_t(c.x) * 0x9e3779b97f4a7c15ULL) ^ (uint64_t(c.y) * 0xc2b2ae3d27d4eb4fULL)
+                     ^ (uint64_t(c.z) * 0x165667b19e3779f9ULL);
+        return h ^ (h >> 29);
+    }
+};
+
+/**
+ * A droplet that cubes can be added to and removed from one at a time while its surface
+ * areas are kept up to date.
+ *
+ * Adding or removing a cube changes the total area by six less two per neighbouring cube,
+ * so that is maintained exactly. The exterior area is the total less the faces shared with
+ * enclosed air, which is tracked as a set of numbered pockets. A change only needs a flood
+ * when a new cube cuts the air around it in two, and then the floods start from the cells
+ * next to it and stop as soon as they reach the exterior or each other, so only the air
+ * that is cut off, or the smaller side of a split pocket, is ever relabelled.
+ */
+class IncrementalDroplet {
+    // The air on each side of a new cube that is not connected within the cube's 3x3x3 neighbourhood
+    struct LocalAir {
+        std::array<Cube, 6> sides;
+        size_t count = 0;
+    };
+
+    SparseVoxels lava;
+    std::unordered_map<Cube, uint32_t, CubeHash> pocketOf;
+    std::vector<SparseVoxels> pockets;
+    std::vector<uint32_t> freePockets;
+    RowExtents extents;
+    size_t area = 0;
+    size_t pocketFaces = 0;
+
+    [[nodiscard]] size_t countNeighbours(const SparseVoxels &voxels, const Cube &cube) const noexcept {
+        auto n = faceNeighbours(cube);
+        return std::count_if(n.begin(), n.end(), [&](const Cube &c) { return voxels.contains(c); });
+    }
+
+    [[nodiscard]] size_t countEnclosed(const Cube &cube) const {
+        auto n = faceNeighbours(cube);
+        return std::count_if(n.begin(), n.end(), [&](const Cube &c) { return pocketOf.contains(c); });
+    }
+
+    [[nodiscard]] LocalAir localAir(const Cube &centre) const;
+
+    /**
+     * Floods from every side of a new cube at once, a cell per side in turn, merging sides
+     * that meet. A side that reaches air which sees out of the droplet is exterior, and once
+     * all but one side have run out of air the last must be the rest of the pocket, or the
+     * exterior, that they were cut from, so it is left unexplored. Returns the air of each
+     * side that ran out.
+     */
+    [[nodiscard]] std::vector<SparseVoxels> cutOff(const LocalAir &air) const;
+
+    // Returns an empty pocket, reusing the number of a released one where there is one
+    uint32_t newPocket();
+
+    // Gives the air a pocket number of its own and adds its faces against the lava to the pocket area
+    void enclose(const SparseVoxels &air);
+
+    // Relabels the cells of the smaller pocket as part of the larger, returning the larger
+    uint32_t merge(uint32_t a, uint32_t b);
+
+    /**
+     * Makes every cell of the pocket exterior air again, taking its faces against the lava off
+     * the pocket area, and frees its number for reuse.
+     */
+    void release(uint32_t pocket);
+
+public:
+    // Returns true if the cube was not already part of the droplet
+    bool insert(const Cube &cube);
+
+    // Returns true if the cube was part of the droplet
+    bool erase(const Cube &cube);
+
+    [[nodiscard]] size_t size() const noexcept { return lava.size(); }
+    [[nodiscard]] size_t surfaceArea() const noexcept { return area; }
+    [[nodiscard]] size_t exteriorSurfaceArea() const noexcept { return area - pocketFaces; }
+
+    // Recomputes both areas from scratch and throws if either disagrees with the maintained value
+    void verify() const;
+};
+
+std::vector<Cube> ingest(std::string_view text, size_t threads);
+
+// Bump whenever a change alters the reports or packed cubes cached for an input
+constexpr std::string_view CacheVersion = "day18/1";
+
+// The ingested cubes as a cache entry, which loads far quicker than the text parses
+std::string packCubes(const std::vector<Cube> &cubes);
+std::vector<Cube> unpackCubes(std::string_view packed);
+
+enum class Storage : uint8_t {
+    // Choose by the fill ratio of the bounding box
+    Auto,
+    Dense,
+    Sparse,
+};
+
+struct Options {
+    // Use the std::set solver, which ignores the options about how to store and search the voxels
+    bool useSets = false;
+    FloodEngine engine = FloodEngine::Queue;
+    Storage storage = Storage::Auto;
+    size_t threads = 1;
+    // Add the cubes one at a time to an IncrementalDroplet
+    bool incremental = false;
+    // Check the incremental areas against a recomputation
+    bool verify = false;
+    /**
+     * List the air pockets in the result. They are found on a dense grid, which the engines
+     * other than dense storage build, throwing before solving if the droplet is too spread out.
+     */
+    bool pockets = false;
+    // Where to write the exterior mesh, if anywhere; it needs a dense grid just as the pockets do
+    std::string meshPath;
+    // Where the set solver allocates its nodes from
+    std::pmr::memory_resource *memory = std::pmr::get_default_resource();
+};
+
+struct Result {
+    size_t part1 = 0;
+    size_t part2 = 0;
+    std::vector<Component> pockets;
+};
+
+// Solves for cubes that have already been ingested; the set solver copies them into a set
+Result solve(const std::vector<Cube> &cubes, const Options &options);
+Result solve(std::string_view input, const Options &options);
+
+// The lines the executable prints for a result, including any pockets
+std::string report(const Result &result);
+
+// The result as a JSON object for --format=json, including any pockets
+std::string toJson(const Result &result);
+
+}
@@ -0,0 +1,127 @@
+//   Copyright 28/12/2022 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include <iostream>
+#include <format>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "day18.h"
+#include "aoc/batch.h"
+#include "aoc/cache.h"
+#include "aoc/input.h"
+#include "aoc/json.h"
+#include "aoc/memory.h"
+#include "aoc/number.h"
+
+int main(int argc, char **argv)
+try {
+    day18::Options options;
+    std::optional<size_t> threads;
+    std::shared_ptr<const aoc::DiskCache> cache;
+    auto allocator = aoc::Allocator::Arena;
+    aoc::Batch batch;
+    for (const auto &arg: aoc::expandArguments(argc, argv)) {
+        if (arg == "--engine=set") {
+            options.useSets = true;
+            continue;
+        } else if (arg == "--engine=queue") {
+            options.useSets = false;
+            options.engine = day18::FloodEngine::Queue;
+            continue;
+        } else if (arg == "--engine=bitwise") {
+            options.useSets = false;
+            options.engine = day18::FloodEngine::Bitwise;
+            continue;
+        } else if (arg == "--storage=dense") {
+            options.storage = day18::Storage::Dense;
+            continue;
+        } else if (arg == "--storage=sparse") {
+            options.storage = day18::Storage::Sparse;
+            continue;
+        } else if (arg == "--storage=auto") {
+            options.storage = day18::Storage::Auto;
+            continue;
+        } else if (arg.starts_with("--mesh=")) {
+            // Only applies to the next input
+            options.meshPath = std::string_view(arg).substr(7);
+            continue;
+        } else if (arg == "--incremental") {
+            options.incremental = true;
+            continue;
+        } else if (arg == "--verify") {
+            options.verify = true;
+            continue;
+        } else if (arg == "--pockets") {
+            options.pockets = true;
+            continue;
+        } else if (arg.starts_with("--threads=")) {
+            threads = std::max<size_t>(1, aoc::parseNumber<size_t>(std::string_view(arg).substr(10)));
+            continue;
+        } else if (arg.starts_with("--alloc=")) {
+            allocator = aoc::parseAllocator(std::string_view(arg).substr(8));
+            continue;
+        } else if (arg == "--cache") {
+            cache = std::make_shared<aoc::DiskCache>(aoc::DiskCache::defaultDirectory());
+            continue;
+        } else if (arg.starts_with("--cache=")) {
+            cache = std::make_shared<aoc::DiskCache>(arg.substr(8));
+            continue;
+        } else if (aoc::parseCommonOption(arg, batch)) {
+            continue;
+        }
+
+        // Concurrent runs already use the cores, so each is single threaded unless asked otherwise
+        options.threads = threads.value_or(batch.jobs() > 1 ? 1 : std::max(1u, std::thread::hardware_concurrency()));
+        batch.add(arg, [arg, options, allocator, cache, format = batch.format()]() mutable {
+            aoc::InputFile file(arg);
+            auto input = file.contents();
+            aoc::RunMemory memory(allocator);
+            options.memory = memory.resource();
+            auto solve = [&] {
+                if (!cache || options.useSets) {
+                    return day18::solve(input, options);
+                }
+                auto cubes = cache->fetch("day18-cubes", day18::CacheVersion, input, [&] {
+                    return day18::packCubes(day18::ingest(input, options.threads));
+                }, day18::unpackCubes);
+                return day18::solve(cubes, options);
+            };
+
+            auto render = [&] {
+                auto result = solve();
+                return format == aoc::Format::Json ? day18::toJson(result) : day18::report(result) + "\n";
+            };
+
+            // Writing a mesh is a side effect a cached report would skip
+            if (cache && options.meshPath.empty()) {
+                auto key = std::format("{} sets={} engine={} storage={} incremental={} verify={} pockets={} format={}",
+                                       day18::CacheVersion, options.useSets, int(options.engine), int(options.storage),
+                                       options.incremental, options.verify, options.pockets,
+                                       format == aoc::Format::Json ? "json" : "text");
+                return cache->fetch("day18-report", key, input, render);
+            }
+            return render();
+        });
+        options.meshPath.clear();
+    }
+    return batch.finish();
+} catch (const std::exception &ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
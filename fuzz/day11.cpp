@@ -0,0 +1,58 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <format>
+#include <string>
+
+#include "day11.h"
+
+fuzz::Target fuzz::day11() {
+    auto generate = [](Random &random, size_t size) {
+        // Worry levels are kept modulo the product of the divisors and squared, so the product
+        // must stay below 2^32, which the first nine primes manage
+        constexpr uint64_t Primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23};
+        auto monkeys = 2 + random.below(std::size(Primes) - 1);
+        std::vector<uint64_t> divisors(Primes, Primes + monkeys);
+        random.shuffle(divisors);
+
+        std::string input;
+        for (size_t m = 0; m < monkeys; m++) {
+            input += std::format("Monkey {}:\n  Starting items: ", m);
+            auto items = 1 + random.below(size);
+            for (size_t i = 0; i < items; i++) {
+                input += std::format("{}{}", i == 0 ? "" : ", ", random.between(1, 99));
+            }
+            switch (random.below(3)) {
+                case 0: input += std::format("\n  Operation: new = old * {}\n", random.between(1, 19)); break;
+                case 1: input += std::format("\n  Operation: new = old + {}\n", random.between(1, 8)); break;
+                default: input += "\n  Operation: new = old * old\n"; break;
+            }
+            // Items are never thrown back to the monkey holding them
+            input += std::format("  Test: divisible by {}\n", divisors[m]);
+            input += std::format("    If true: throw to monkey {}\n", (m + 1 + random.below(monkeys - 1)) % monkeys);
+            input += std::format("    If false: throw to monkey {}\n\n", (m + 1 + random.below(monkeys - 1)) % monkeys);
+        }
+        input.pop_back();
+        return input;
+    };
+
+    // Only the parser's line splitting is dispatched, and the solver takes no allocator
+    auto compare = [](std::string_view input) {
+        return acrossIsas([&] { return day11::toJson(day11::solve(input)); }).result();
+    };
+    return {"day11", generate, compare};
+}
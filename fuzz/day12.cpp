@@ -0,0 +1,140 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "day12.h"
+
+namespace {
+    // What either side gives for a start walled off from the end
+    constexpr std::string_view Unreachable = "error: The start cannot reach the end";
+
+    /**
+     * A breadth first search from every lowest square, where the solver searches once backwards
+     * from the end. Rejects anything but a rectangle of heights with one start and one end. A
+     * start that cannot reach the end has no answer, which the solver must report as an error.
+     */
+    std::string reference(std::string_view input) {
+        std::vector<std::string_view> rows;
+        for (size_t start = 0; start < input.size();) {
+            auto end = std::min(input.find('\n', start), input.size());
+            rows.push_back(input.substr(start, end - start));
+            start = end + 1;
+        }
+        if (rows.empty() || std::any_of(rows.begin(), rows.end(), [&](auto row) { return row.size() != rows[0].size(); })) {
+            throw std::runtime_error("The map is not a rectangle");
+        }
+
+        auto width = rows[0].size();
+        std::string heights;
+        size_t start = SIZE_MAX;
+        size_t end = SIZE_MAX;
+        for (auto row: rows) {
+            for (char c: row) {
+                if (c == 'S' || c == 'E') {
+                    auto &position = c == 'S' ? start : end;
+                    if (position != SIZE_MAX) {
+                        throw std::runtime_error(std::format("More than one {}", c));
+                    }
+                    position = heights.size();
+                    c = c == 'S' ? 'a' : 'z';
+                } else if (c < 'a' || c > 'z') {
+                    throw std::runtime_error(std::format("'{}' is not a height", c));
+                }
+                heights += c;
+            }
+        }
+        if (start == SIZE_MAX || end == SIZE_MAX) {
+            throw std::runtime_error("The map needs a start and an end");
+        }
+
+        auto stepsToEnd = [&](size_t from) {
+            std::vector<uint64_t> steps(heights.size(), UINT64_MAX);
+            std::deque<size_t> queue{from};
+            steps[from] = 0;
+            while (!queue.empty()) {
+                auto square = queue.front();
+                queue.pop_front();
+                if (square == end) {
+                    return steps[square];
+                }
+                auto x = square % width;
+                for (auto next: {x > 0 ? square - 1 : SIZE_MAX, x + 1 < width ? square + 1 : SIZE_MAX,
+                                 square >= width ? square - width : SIZE_MAX, square + width}) {
+                    if (next < heights.size() && steps[next] == UINT64_MAX && heights[next] <= heights[square] + 1) {
+                        steps[next] = steps[square] + 1;
+                        queue.push_back(next);
+                    }
+                }
+            }
+            return UINT64_MAX;
+        };
+
+        day12::Result result{stepsToEnd(start), UINT64_MAX};
+        if (result.part1 == UINT64_MAX) {
+            return std::string(Unreachable);
+        }
+        for (size_t square = 0; square < heights.size(); square++) {
+            if (heights[square] == 'a') {
+                result.part2 = std::min(result.part2, stepsToEnd(square));
+            }
+        }
+        return day12::toJson(result);
+    }
+}
+
+fuzz::Target fuzz::day12() {
+    auto generate = [](Random &random, size_t size) {
+        // A random walk of heights, so that some paths climb all the way and some are walled off
+        auto width = 2 + random.below(size + 1);
+        auto height = 1 + random.below(size / 2 + 1);
+        auto start = random.below(width * height);
+        auto end = random.below(width * height - 1);
+        end += end >= start ? 1 : 0;
+
+        std::string input;
+        int h = int(random.below(26));
+        for (size_t i = 0; i < width * height; i++) {
+            h = std::clamp(h + int(random.between(-1, 2)), 0, 25);
+            input += i == start ? 'S' : i == end ? 'E' : char('a' + h);
+            if (i % width == width - 1) {
+                input += '\n';
+            }
+        }
+        return input;
+    };
+
+    auto compare = [](std::string_view input) {
+        Comparison comparison(reference(input));
+        checkVariants(comparison, [&](std::pmr::memory_resource *memory) {
+            try {
+                return day12::toJson(day12::solve(input, memory));
+            } catch (const std::runtime_error &ex) {
+                return std::format("error: {}", ex.what());
+            }
+        });
+        return comparison.result();
+    };
+    return {"day12", generate, compare};
+}
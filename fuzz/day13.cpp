@@ -0,0 +1,61 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <string>
+
+#include "day13.h"
+
+namespace {
+    void writePacket(fuzz::Random &random, std::string &out, unsigned depth) {
+        out += '[';
+        auto count = random.below(5);
+        for (size_t i = 0; i < count; i++) {
+            if (i > 0) {
+                out += ',';
+            }
+            if (depth > 1 && random.chance(40)) {
+                writePacket(random, out, depth - 1);
+            } else {
+                out += std::to_string(random.below(11));
+            }
+        }
+        out += ']';
+    }
+}
+
+fuzz::Target fuzz::day13() {
+    auto generate = [](Random &random, size_t size) {
+        std::string input;
+        auto pairs = 1 + random.below(size);
+        for (size_t i = 0; i < pairs; i++) {
+            for (int packet = 0; packet < 2; packet++) {
+                writePacket(random, input, 1 + unsigned(random.below(4)));
+                input += '\n';
+            }
+            input += i + 1 < pairs ? "\n" : "";
+        }
+        return input;
+    };
+
+    // The packets are parsed into the run's memory, so every allocator is worth checking
+    auto compare = [](std::string_view input) {
+        return acrossVariants([&](std::pmr::memory_resource *memory) {
+            return day13::toJson(day13::solve(input, memory));
+        }).result();
+    };
+    return {"day13", generate, compare};
+}
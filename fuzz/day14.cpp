@@ -0,0 +1,165 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "aoc/number.h"
+#include "day14.h"
+
+namespace {
+    /**
+     * Drops grains one at a time through a plain grid, once without the floor for part 1 and
+     * once with it for part 2, where the solver does both in one pass over a set of rocks.
+     * Rejects paths the puzzle does not have: single points, and diagonal or empty segments.
+     */
+    std::string reference(std::string_view input) {
+        std::vector<std::vector<std::pair<int, int>>> paths;
+        for (size_t start = 0; start < input.size();) {
+            auto end = std::min(input.find('\n', start), input.size());
+            auto line = input.substr(start, end - start);
+            start = end + 1;
+            auto &path = paths.emplace_back();
+            for (size_t from = 0; from <= line.size();) {
+                auto to = std::min(line.find(" -> ", from), line.size());
+                auto point = line.substr(from, to - from);
+                auto comma = point.find(',');
+                path.emplace_back(aoc::parseNumber<int>(point.substr(0, comma)),
+                                  aoc::parseNumber<int>(point.substr(comma + 1)));
+                from = to + 4;
+            }
+            if (path.size() < 2) {
+                throw std::runtime_error("A path needs at least two points");
+            }
+            for (size_t i = 1; i < path.size(); i++) {
+                if ((path[i].first == path[i - 1].first) == (path[i].second == path[i - 1].second)) {
+                    throw std::runtime_error("Segments must run along a row or a column");
+                }
+            }
+        }
+        if (paths.empty()) {
+            throw std::runtime_error("There is no rock");
+        }
+
+        int lowest = 0;
+        int left = 500;
+        int right = 500;
+        for (const auto &path: paths) {
+            for (auto [x, y]: path) {
+                lowest = std::max(lowest, y);
+                left = std::min(left, x);
+                right = std::max(right, x);
+            }
+        }
+        // Sand spreads no further sideways than it falls, and the floor is two below the lowest rock
+        left = std::min(left, 500 - lowest - 3);
+        right = std::max(right, 500 + lowest + 3);
+        auto width = size_t(right - left + 1);
+        std::vector<char> rock(width * size_t(lowest + 2), 0);
+        auto at = [&](std::vector<char> &grid, int x, int y) -> char & { return grid[size_t(y) * width + size_t(x - left)]; };
+        for (const auto &path: paths) {
+            for (size_t i = 1; i < path.size(); i++) {
+                auto [x0, x1] = std::minmax(path[i - 1].first, path[i].first);
+                auto [y0, y1] = std::minmax(path[i - 1].second, path[i].second);
+                for (int y = y0; y <= y1; y++) {
+                    for (int x = x0; x <= x1; x++) {
+                        at(rock, x, y) = 1;
+                    }
+                }
+            }
+        }
+        if (at(rock, 500, 0)) {
+            throw std::runtime_error("The source is inside rock");
+        }
+
+        // Grains that come to rest before one falls past every rock, or with the floor, before the source is blocked
+        auto pour = [&](bool floor) {
+            auto grid = rock;
+            int grains = 0;
+            while (true) {
+                int x = 500;
+                int y = 0;
+                while (y <= lowest) {
+                    if (!at(grid, x, y + 1)) {
+                        y++;
+                    } else if (!at(grid, x - 1, y + 1)) {
+                        x--;
+                        y++;
+                    } else if (!at(grid, x + 1, y + 1)) {
+                        x++;
+                        y++;
+                    } else {
+                        break;
+                    }
+                }
+                if (y > lowest && !floor) {
+                    return grains;
+                }
+                at(grid, x, y) = 1;
+                grains++;
+                if (x == 500 && y == 0) {
+                    return grains;
+                }
+            }
+        };
+        return day14::toJson({pour(false), pour(true)});
+    }
+}
+
+fuzz::Target fuzz::day14() {
+    auto generate = [](Random &random, size_t size) {
+        // Shallow, as the sand piles up in a triangle as deep as the lowest rock
+        int depth = int(2 + random.below(std::min<size_t>(size, 20) + 1));
+        std::string input;
+        auto paths = 1 + random.below(size);
+        for (size_t i = 0; i < paths; i++) {
+            int y = int(random.between(1, depth));
+            int x = int(random.between(500 - depth, 500 + depth));
+            input += std::to_string(x) + ',' + std::to_string(y);
+            auto segments = 1 + random.below(4);
+            for (size_t s = 0; s < segments; s++) {
+                // Segments alternate between rows and columns and are never of zero length,
+                // which the parser cannot walk along
+                auto length = int(random.between(1, 5));
+                if (s % 2 == 0) {
+                    x += random.chance(50) ? length : -length;
+                } else if (y + length <= depth && (y - length < 1 || random.chance(50))) {
+                    y += length;
+                } else if (y - length >= 1) {
+                    y -= length;
+                } else {
+                    break;
+                }
+                input += " -> " + std::to_string(x) + ',' + std::to_string(y);
+            }
+            input += '\n';
+        }
+        return input;
+    };
+
+    auto compare = [](std::string_view input) {
+        Comparison comparison(reference(input));
+        checkVariants(comparison, [&](std::pmr::memory_resource *memory) {
+            return day14::toJson(day14::solve(input, memory));
+        });
+        return comparison.result();
+    };
+    return {"day14", generate, compare};
+}
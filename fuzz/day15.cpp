@@ -0,0 +1,189 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "aoc/number.h"
+#include "day15.h"
+
+namespace {
+    // Tiny boards only: every position of the search square is looked at
+    constexpr int64_t MaxSquareSide = 1024;
+
+    /**
+     * Looks at every position of the row, and of the square, against every sensor, where the
+     * solver merges each row's intervals. Rejects inputs the puzzle promises not to give, where
+     * more than one position of the square is out of reach.
+     */
+    std::string reference(std::string_view sensors, int row) {
+        struct Reach {
+            int64_t x, y, beaconX, beaconY, strength;
+        };
+        std::vector<Reach> reaches;
+        for (size_t start = 0; start < sensors.size();) {
+            auto end = std::min(sensors.find('\n', start), sensors.size());
+            auto line = std::string(sensors.substr(start, end - start));
+            start = end + 1;
+            Reach reach{};
+            if (std::sscanf(line.c_str(), "Sensor at x=%" SCNd64 ", y=%" SCNd64 ": closest beacon is at x=%" SCNd64
+                            ", y=%" SCNd64, &reach.x, &reach.y, &reach.beaconX, &reach.beaconY) != 4) {
+                throw std::runtime_error(std::format("Not a sensor: '{}'", line));
+            }
+            reach.strength = std::abs(reach.x - reach.beaconX) + std::abs(reach.y - reach.beaconY);
+            reaches.push_back(reach);
+        }
+        auto reached = [&](int64_t x, int64_t y) {
+            return std::any_of(reaches.begin(), reaches.end(), [=](const Reach &reach) {
+                return std::abs(reach.x - x) + std::abs(reach.y - y) <= reach.strength;
+            });
+        };
+
+        day15::Result result;
+        if (!reaches.empty()) {
+            auto left = reaches.front().x;
+            auto right = left;
+            for (const auto &reach: reaches) {
+                left = std::min(left, reach.x - reach.strength);
+                right = std::max(right, reach.x + reach.strength);
+            }
+            for (auto x = left; x <= right; x++) {
+                auto beacon = std::any_of(reaches.begin(), reaches.end(), [=](const Reach &reach) {
+                    return reach.beaconX == x && reach.beaconY == row;
+                });
+                result.part1 += reached(x, row) && !beacon ? 1 : 0;
+            }
+        }
+
+        int64_t side = 2 * int64_t(row) + 1;
+        if (side > MaxSquareSide) {
+            throw std::runtime_error(std::format("A square of side {} is too big to scan", side));
+        }
+        size_t free = 0;
+        for (int64_t y = 0; y < side; y++) {
+            for (int64_t x = 0; x < side; x++) {
+                if (!reached(x, y)) {
+                    free++;
+                    result.beacon = day15::Point(int(x), int(y));
+                }
+            }
+        }
+        if (free > 1) {
+            throw std::runtime_error(std::format("{} positions are out of reach", free));
+        }
+        return day15::toJson(result);
+    }
+
+    void writeSensor(fuzz::Random &random, std::string &out, int64_t x, int64_t y, int64_t radius) {
+        auto dx = random.between(0, radius);
+        auto dy = radius - dx;
+        auto beaconX = x + (random.chance(50) ? dx : -dx);
+        auto beaconY = y + (random.chance(50) ? dy : -dy);
+        out += std::format("Sensor at x={}, y={}: closest beacon is at x={}, y={}\n", x, y, beaconX, beaconY);
+    }
+}
+
+fuzz::Target fuzz::day15() {
+    // The first line is the row, then come the sensors
+    auto generate = [](Random &random, size_t size) {
+        // As tools/generate does: sensors on a lattice with spacing s and reach s cover the
+        // square between them, less those near the hidden beacon, which four sensors 2s away
+        // diagonally cover for everything but the beacon, as the puzzle promises.
+        auto extent = int64_t(4 + 2 * random.below(4 * size + 1));
+        auto perSide = 1 + int64_t(random.below(std::max<size_t>(1, size / 4) + 1));
+        auto spacing = std::max<int64_t>(1, (extent + perSide - 1) / perSide);
+        auto hiddenX = random.between(1, extent - 1);
+        auto hiddenY = random.between(1, extent - 1);
+
+        std::string input = std::format("{}\n", extent / 2);
+        for (int64_t y = 0; y < extent + spacing; y += spacing) {
+            for (int64_t x = 0; x < extent + spacing; x += spacing) {
+                if (std::abs(x - hiddenX) + std::abs(y - hiddenY) > spacing) {
+                    writeSensor(random, input, x, y, spacing);
+                }
+            }
+        }
+        auto offset = 2 * spacing;
+        for (auto [dx, dy]: {std::pair{1, 1}, std::pair{1, -1}, std::pair{-1, 1}, std::pair{-1, -1}}) {
+            writeSensor(random, input, hiddenX + dx * offset, hiddenY + dy * offset, 2 * offset - 1);
+        }
+        return input;
+    };
+
+    auto solve = [](std::string_view input) {
+        auto newline = input.find('\n');
+        auto row = aoc::parseNumber<int>(input.substr(0, newline));
+        return day15::toJson(day15::solve(input.substr(newline + 1), row));
+    };
+
+    auto compare = [solve](std::string_view input) {
+        auto newline = input.find('\n');
+        auto row = aoc::parseNumber<int>(input.substr(0, newline));
+        auto sensors = input.substr(newline + 1);
+        std::string expected;
+        try {
+            expected = reference(sensors, row);
+        } catch (const std::exception &) {
+            // Inputs the puzzle rules out have no answer to compare, but the solver must still
+            // survive them, so a crash on one is not hidden
+            atEveryIsa([&] {
+                try {
+                    solve(input);
+                } catch (const std::exception &) {
+                }
+            });
+            throw;
+        }
+        Comparison comparison(std::move(expected));
+        checkIsas(comparison, [&] { return solve(input); });
+        return comparison.result();
+    };
+    /*
+     * Each of these broke the interval sweep. Their answers are worked out from the sensors'
+     * diamonds by hand; the square is 0 to 2 * row on each side.
+     */
+    std::vector<Regression> regressions{
+        // The only sensor's diamond misses row 0, the whole square, so both parts merged no ranges
+        {"no range on the row", "0\nSensor at x=10, y=10: closest beacon is at x=10, y=11\n",
+         R"({"part1":0,"part2":0,"beacon":{"x":0,"y":0}})"},
+        // Only the far corner of the square, 8 from the sensor, is out of its reach of 7
+        {"free position at the edge of its row", "2\nSensor at x=0, y=0: closest beacon is at x=0, y=7\n",
+         R"({"part1":11,"part2":16000004,"beacon":{"x":4,"y":4}})"},
+        // As above, with a second sensor whose range on row 4, 7 to 11, lies wholly right of the square
+        {"range outside the square clamped onto its edge",
+         "2\nSensor at x=0, y=0: closest beacon is at x=0, y=7\n"
+         "Sensor at x=9, y=4: closest beacon is at x=11, y=4\n",
+         R"({"part1":12,"part2":16000004,"beacon":{"x":4,"y":4}})"},
+        // Row 2 is covered from -5 to 5 in one range that holds two beacons
+        {"range with two beacons on the row",
+         "2\nSensor at x=0, y=0: closest beacon is at x=0, y=7\n"
+         "Sensor at x=1, y=1: closest beacon is at x=1, y=2\n"
+         "Sensor at x=-1, y=1: closest beacon is at x=-1, y=2\n",
+         R"({"part1":9,"part2":16000004,"beacon":{"x":4,"y":4}})"},
+        // Outside the puzzle's promise, as rows 0 and 1 are out of reach, so the oracle rejects it;
+        // the solver answers with the first free position rather than failing on the empty row
+        {"row of the square that no sensor reaches", "1\nSensor at x=1, y=3: closest beacon is at x=1, y=4\n",
+         R"({"part1":0,"part2":0,"beacon":{"x":0,"y":0}})"},
+    };
+    return {"day15", generate, compare, solve, std::move(regressions)};
+}
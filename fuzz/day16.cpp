@@ -0,0 +1,115 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <algorithm>
+#include <format>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "day16.h"
+
+fuzz::Target fuzz::day16() {
+    auto generate = [](Random &random, size_t size) {
+        // Few enough useful valves that the search engine, the oracle, stays quick
+        auto valves = 2 + random.below(std::min<size_t>(size, 24) + 1);
+        auto useful = 1 + random.below(std::min<size_t>(valves - 1, 8));
+
+        // AA first and without flow, as in the puzzle, then other labels in a random order
+        std::vector<std::string> labels;
+        for (char a = 'A'; a <= 'Z'; a++) {
+            for (char b = 'A'; b <= 'Z'; b++) {
+                labels.push_back({a, b});
+            }
+        }
+        std::vector<std::string> picked(labels.begin() + 1, labels.end());
+        random.shuffle(picked);
+        picked.resize(valves - 1);
+        picked.insert(picked.begin(), "AA");
+
+        std::vector<size_t> rates(valves, 0);
+        std::vector<size_t> order(valves - 1);
+        std::iota(order.begin(), order.end(), 1);
+        random.shuffle(order);
+        for (size_t i = 0; i < useful; i++) {
+            rates[order[i]] = random.between(1, 25);
+        }
+
+        // Now and then some valves without flow are cut off from AA, which has to be no obstacle
+        std::vector<bool> island(valves, false);
+        if (random.chance(20)) {
+            for (size_t i = useful; i < order.size(); i++) {
+                island[order[i]] = random.chance(50);
+            }
+        }
+
+        // A random spanning tree of each side keeps every valve reachable from the others on
+        // it, and extra tunnels make loops
+        std::vector<std::vector<size_t>> tunnels(valves);
+        auto connect = [&](size_t a, size_t b) {
+            if (a != b && island[a] == island[b] && std::find(tunnels[a].begin(), tunnels[a].end(), b) == tunnels[a].end()) {
+                tunnels[a].push_back(b);
+                tunnels[b].push_back(a);
+            }
+        };
+        for (size_t v = 1; v < valves; v++) {
+            std::vector<size_t> earlier;
+            for (size_t u = 0; u < v; u++) {
+                if (island[u] == island[v]) {
+                    earlier.push_back(u);
+                }
+            }
+            if (!earlier.empty()) {
+                connect(v, earlier[random.below(earlier.size())]);
+            }
+        }
+        for (size_t e = random.below(valves); e > 0; e--) {
+            connect(random.below(valves), random.below(valves));
+        }
+
+        std::string input;
+        for (size_t v = 0; v < valves; v++) {
+            input += std::format("Valve {} has flow rate={}; ", picked[v], rates[v]);
+            input += tunnels[v].size() == 1 ? "tunnel leads to valve " : "tunnels lead to valves ";
+            for (size_t i = 0; i < tunnels[v].size(); i++) {
+                input += (i == 0 ? "" : ", ") + picked[tunnels[v][i]];
+            }
+            input += '\n';
+        }
+        return input;
+    };
+
+    // The breadth first search over every order of opening valves is the oracle
+    auto compare = [](std::string_view input) {
+        auto comparison = acrossVariants([&](std::pmr::memory_resource *memory) {
+            return day16::toJson(day16::solve(input, day16::Engine::Search, memory));
+        });
+        comparison.check("engine=dp", [&] {
+            return day16::toJson(day16::solve(input, day16::Engine::Table));
+        });
+        // As a cached network is loaded
+        auto packed = day16::packNetwork(day16::parse(input));
+        comparison.check("cached engine=search", [&] {
+            return day16::toJson(day16::solve(day16::unpackNetwork(packed), day16::Engine::Search));
+        });
+        comparison.check("cached engine=dp", [&] {
+            return day16::toJson(day16::solve(day16::unpackNetwork(packed), day16::Engine::Table));
+        });
+        return comparison.result();
+    };
+    return {"day16", generate, compare};
+}
@@ -0,0 +1,144 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <format>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "aoc/cpu.h"
+#include "day18.h"
+
+namespace {
+    // Every combination of the faster engines' options
+    std::vector<day18::Options> engines() {
+        std::vector<day18::Options> all;
+        for (auto storage: {day18::Storage::Dense, day18::Storage::Sparse, day18::Storage::Auto}) {
+            for (auto engine: {day18::FloodEngine::Queue, day18::FloodEngine::Bitwise}) {
+                for (size_t threads: {1, 3}) {
+                    day18::Options options;
+                    options.storage = storage;
+                    options.engine = engine;
+                    options.threads = threads;
+                    all.push_back(options);
+                }
+            }
+        }
+        day18::Options incremental;
+        incremental.incremental = true;
+        incremental.verify = true;
+        all.push_back(incremental);
+        return all;
+    }
+
+    std::string describe(const day18::Options &options) {
+        if (options.incremental) {
+            return "incremental";
+        }
+        constexpr std::string_view Storages[] = {"auto", "dense", "sparse"};
+        return std::format("storage={} engine={} threads={}", Storages[size_t(options.storage)],
+                           options.engine == day18::FloodEngine::Queue ? "queue" : "bitwise", options.threads);
+    }
+}
+
+fuzz::Target fuzz::day18() {
+    auto generate = [](Random &random, size_t size) {
+        // A small lumpy ball, dense enough to seal some pockets, and now and then a few stray
+        // cubes further out so that the sparse store is chosen
+        auto extent = 1 + random.below(std::min<size_t>(size, 12));
+        auto density = 40 + unsigned(random.below(60));
+        std::vector<std::string> lines;
+        for (uint32_t z = 0; z < extent; z++) {
+            for (uint32_t y = 0; y < extent; y++) {
+                for (uint32_t x = 0; x < extent; x++) {
+                    if (random.chance(density)) {
+                        lines.push_back(std::format("{},{},{}", x, y, z));
+                    }
+                }
+            }
+        }
+        if (lines.empty() || random.chance(10)) {
+            for (auto strays = 1 + random.below(4); strays > 0; strays--) {
+                lines.push_back(std::format("{},{},{}", random.below(24), random.below(24), random.below(24)));
+            }
+        }
+        random.shuffle(lines);
+        std::string input;
+        for (const auto &line: lines) {
+            input += line + '\n';
+        }
+        return input;
+    };
+
+    auto compare = [](std::string_view input) {
+        // The std::set solver, with findAirPockets, is the oracle. It is cubic in the bounding
+        // box, and uses no kernels, so it is only run the once.
+        day18::Options sets;
+        sets.useSets = true;
+        Comparison comparison(day18::toJson(day18::solve(input, sets)));
+        auto best = aoc::cpu::detected();
+        for (auto level = size_t(aoc::cpu::Isa::Scalar); level <= size_t(best); level++) {
+            auto isa = aoc::cpu::Isa(level);
+            aoc::cpu::select(isa);
+            for (const auto &options: engines()) {
+                comparison.check(std::format("{} isa={}", describe(options), aoc::cpu::name(isa)), [&] {
+                    return day18::toJson(day18::solve(input, options));
+                });
+            }
+        }
+        aoc::cpu::select(best);
+        if (auto what = comparison.result()) {
+            return what;
+        }
+
+        // Taking every third cube back out of an incremental droplet should leave the areas the rest have
+        auto cubes = day18::ingest(input, 1);
+        std::set<day18::Cube> erased;
+        for (size_t i = 0; i < cubes.size(); i += 3) {
+            erased.insert(cubes[i]);
+        }
+        std::pmr::set<day18::Cube> rest;
+        for (const auto &cube: cubes) {
+            if (!erased.contains(cube)) {
+                rest.insert(cube);
+            }
+        }
+        if (rest.empty()) {
+            return std::optional<std::string>();
+        }
+        day18::Result remaining;
+        remaining.part1 = day18::surfaceArea(rest);
+        remaining.part2 = remaining.part1 - day18::surfaceArea(day18::findAirPockets(rest));
+        Comparison afterErase(day18::toJson(remaining));
+        afterErase.check("incremental after erasing every third cube", [&] {
+            day18::IncrementalDroplet droplet;
+            for (const auto &cube: cubes) {
+                droplet.insert(cube);
+            }
+            for (const auto &cube: erased) {
+                droplet.erase(cube);
+            }
+            droplet.verify();
+            day18::Result result;
+            result.part1 = droplet.surfaceArea();
+            result.part2 = droplet.exteriorSurfaceArea();
+            return day18::toJson(result);
+        });
+        return afterErase.result();
+    };
+    return {"day18", generate, compare};
+}
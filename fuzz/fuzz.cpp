@@ -0,0 +1,198 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <cctype>
+
+#include "aoc/cpu.h"
+#include "aoc/memory.h"
+
+namespace fuzz {
+
+namespace {
+    constexpr aoc::Allocator Allocators[] = {aoc::Allocator::Default, aoc::Allocator::Arena, aoc::Allocator::Pool};
+    constexpr std::string_view AllocatorNames[] = {"default", "arena", "pool"};
+
+    // Even when a run throws, whatever is checked after it should have the best there is
+    struct RestoreIsa {
+        ~RestoreIsa() { aoc::cpu::select(aoc::cpu::detected()); }
+    };
+
+    // The parts of input between separators, ignoring its final newlines
+    std::vector<std::string> split(std::string_view input, std::string_view separator) {
+        while (input.ends_with('\n')) {
+            input.remove_suffix(1);
+        }
+        std::vector<std::string> parts;
+        size_t start = 0;
+        for (auto end = input.find(separator); end != std::string_view::npos; end = input.find(separator, start)) {
+            parts.emplace_back(input.substr(start, end - start));
+            start = end + separator.size();
+        }
+        if (start < input.size()) {
+            parts.emplace_back(input.substr(start));
+        }
+        return parts;
+    }
+
+    // The parts with separators between them and a newline at the end, as every input has
+    std::string join(const std::vector<std::string> &parts, std::string_view separator) {
+        std::string joined;
+        for (const auto &part: parts) {
+            if (!joined.empty()) {
+                joined += separator;
+            }
+            joined += part;
+        }
+        return joined + '\n';
+    }
+
+    /**
+     * Removes runs of parts, halving the run length each time none of them can go, for as long
+     * as what is left still disagrees.
+     */
+    std::vector<std::string> removeParts(const Target &target, std::vector<std::string> parts,
+                                         std::string_view separator) {
+        for (size_t run = std::max<size_t>(1, parts.size() / 2); run > 0; run /= 2) {
+            for (size_t i = 0; i < parts.size() && parts.size() > 1;) {
+                auto candidate = parts;
+                candidate.erase(candidate.begin() + ptrdiff_t(i),
+                                candidate.begin() + ptrdiff_t(std::min(i + run, candidate.size())));
+                if (!candidate.empty() && disagreement(target, join(candidate, separator))) {
+                    parts = std::move(candidate);
+                } else {
+                    i += run;
+                }
+            }
+        }
+        return parts;
+    }
+
+    // Replaces each number with zero, or else half of it, or else one less, while that still disagrees
+    std::string shrinkNumbers(const Target &target, std::string input) {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (size_t i = 0; i < input.size();) {
+                if (!std::isdigit(static_cast<unsigned char>(input[i]))) {
+                    i++;
+                    continue;
+                }
+                auto end = i;
+                while (end < input.size() && std::isdigit(static_cast<unsigned char>(input[end]))) {
+                    end++;
+                }
+                // Long runs of digits are left alone rather than overflowing
+                auto digits = input.substr(i, end - i);
+                uint64_t value = digits.size() < 18 ? std::stoull(digits) : 0;
+                for (auto smaller: {uint64_t(0), value / 2, value - 1}) {
+                    if (value == 0 || smaller >= value) {
+                        continue;
+                    }
+                    auto candidate = input.substr(0, i) + std::to_string(smaller) + input.substr(end);
+                    if (disagreement(target, candidate)) {
+                        input = std::move(candidate);
+                        changed = true;
+                        break;
+                    }
+                }
+                while (i < input.size() && std::isdigit(static_cast<unsigned char>(input[i]))) {
+                    i++;
+                }
+            }
+        }
+        return input;
+    }
+}
+
+void atEveryIsa(const std::function<void()> &run) {
+    RestoreIsa restore;
+    for (auto level = size_t(aoc::cpu::Isa::Scalar); level <= size_t(aoc::cpu::detected()); level++) {
+        aoc::cpu::select(aoc::cpu::Isa(level));
+        run();
+    }
+}
+
+void checkVariants(Comparison &comparison, const std::function<std::string(std::pmr::memory_resource *)> &run) {
+    atEveryIsa([&] {
+        auto isa = aoc::cpu::name(aoc::cpu::selected());
+        for (size_t a = 0; a < std::size(Allocators); a++) {
+            comparison.check(std::format("isa={} alloc={}", isa, AllocatorNames[a]), [&] {
+                aoc::RunMemory memory(Allocators[a]);
+                return run(memory.resource());
+            });
+        }
+    });
+}
+
+void checkIsas(Comparison &comparison, const std::function<std::string()> &run) {
+    atEveryIsa([&] {
+        comparison.check(std::format("isa={}", aoc::cpu::name(aoc::cpu::selected())), run);
+    });
+}
+
+Comparison acrossVariants(const std::function<std::string(std::pmr::memory_resource *)> &run) {
+    RestoreIsa restore;
+    aoc::cpu::select(aoc::cpu::Isa::Scalar);
+    auto oracle = [&] {
+        aoc::RunMemory memory(aoc::Allocator::Default);
+        return run(memory.resource());
+    }();
+    Comparison comparison(std::move(oracle));
+    checkVariants(comparison, run);
+    return comparison;
+}
+
+Comparison acrossIsas(const std::function<std::string()> &run) {
+    RestoreIsa restore;
+    aoc::cpu::select(aoc::cpu::Isa::Scalar);
+    Comparison comparison(run());
+    checkIsas(comparison, run);
+    return comparison;
+}
+
+std::optional<std::string> disagreement(const Target &target, std::string_view input) {
+    try {
+        return target.compare(input);
+    } catch (const std::exception &) {
+        return std::nullopt;
+    }
+}
+
+std::optional<std::string> checkRegressions(const Target &target) {
+    for (const auto &regression: target.regressions) {
+        Comparison comparison{std::string(regression.expected)};
+        checkIsas(comparison, [&] { return target.solve(regression.input); });
+        auto what = comparison.result();
+        if (!what) {
+            what = disagreement(target, regression.input);
+        }
+        if (what) {
+            return std::format("regression '{}': {}", regression.what, *what);
+        }
+    }
+    return std::nullopt;
+}
+
+std::string shrink(const Target &target, std::string input) {
+    if (input.find("\n\n") != std::string::npos) {
+        input = join(removeParts(target, split(input, "\n\n"), "\n\n"), "\n\n");
+    }
+    input = join(removeParts(target, split(input, "\n"), "\n"), "\n");
+    return shrinkNumbers(target, std::move(input));
+}
+
+}
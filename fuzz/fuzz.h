@@ -0,0 +1,165 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <functional>
+#include <memory_resource>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * Differential tests of each day's solvers: random valid inputs are solved by the original,
+ * straightforward implementation and by every faster engine, instruction set and allocator,
+ * and any disagreement is shrunk to a minimal input that still shows it.
+ */
+namespace fuzz {
+
+/**
+ * A seeded source of numbers that does not depend on the standard library's distributions,
+ * so that a seed reproduces the same input everywhere.
+ */
+class Random {
+    std::mt19937_64 engine;
+
+public:
+    explicit Random(uint64_t seed) : engine(seed) {}
+
+    uint64_t below(uint64_t n) { return engine() % n; }
+
+    int64_t between(int64_t min, int64_t max) { return min + int64_t(below(uint64_t(max - min + 1))); }
+
+    bool chance(unsigned percent) { return below(100) < percent; }
+
+    template<typename T>
+    void shuffle(std::vector<T> &values) {
+        for (size_t i = values.size(); i > 1; i--) {
+            std::swap(values[i - 1], values[below(i)]);
+        }
+    }
+};
+
+/**
+ * The oracle's answer to one input, against which each engine's answer is checked. Answers
+ * are compared as the days' toJson output. Only the first disagreement is kept, and an engine
+ * that throws where the oracle did not disagrees with it.
+ */
+class Comparison {
+    std::string expected;
+    std::optional<std::string> disagreement;
+
+public:
+    explicit Comparison(std::string oracle) : expected(std::move(oracle)) {}
+
+    template <typename Run>
+    void check(std::string_view engine, Run &&run) {
+        if (disagreement) {
+            return;
+        }
+        try {
+            auto actual = run();
+            if (actual != expected) {
+                disagreement = std::format("{} gave {} but the oracle gave {}", engine, actual, expected);
+            }
+        } catch (const std::exception &ex) {
+            disagreement = std::format("{} threw '{}' but the oracle gave {}", engine, ex.what(), expected);
+        }
+    }
+
+    [[nodiscard]] std::optional<std::string> result() const { return disagreement; }
+};
+
+// Runs run at every instruction set level the CPU has, leaving the best one selected
+void atEveryIsa(const std::function<void()> &run);
+
+// Checks run, which solves an input with the given memory, at every instruction set and with every allocator
+void checkVariants(Comparison &comparison, const std::function<std::string(std::pmr::memory_resource *)> &run);
+
+// Checks run at every instruction set, for solvers that take no allocator
+void checkIsas(Comparison &comparison, const std::function<std::string()> &run);
+
+/**
+ * Checks run at every instruction set level the CPU has and with every allocator, against the
+ * oracle that the first of them, scalar code with plain new and delete, gives. This only
+ * shows that the dispatched kernels and allocators change nothing, so days with a simpler,
+ * independent solver compare against that instead.
+ */
+Comparison acrossVariants(const std::function<std::string(std::pmr::memory_resource *)> &run);
+
+// As acrossVariants, for solvers that take no allocator
+Comparison acrossIsas(const std::function<std::string()> &run);
+
+/**
+ * An input that once broke a solver, with its answer worked out by hand rather than by an
+ * oracle, so that changing the oracle cannot quietly change what the solver is held to.
+ */
+struct Regression {
+    // What the input broke
+    std::string_view what;
+    std::string_view input;
+    // The day's toJson output for the input
+    std::string_view expected;
+};
+
+struct Target {
+    std::string_view day;
+    // A random valid input with roughly size records in it
+    std::function<std::string(Random &random, size_t size)> generate;
+    /**
+     * Solves input with the oracle and every engine, and describes the first disagreement if
+     * there is one. Throws if the oracle cannot solve it, which shrinking takes to mean that
+     * the input is no longer valid.
+     */
+    std::function<std::optional<std::string>(std::string_view input)> compare;
+    // Solves input with the day's solver, for the regressions; unset for a day with none
+    std::function<std::string(std::string_view input)> solve = {};
+    std::vector<Regression> regressions = {};
+};
+
+Target day11();
+Target day12();
+Target day13();
+Target day14();
+Target day15();
+Target day16();
+Target day18();
+
+// Not a day: number.h's SWAR parser against std::from_chars, at every width and signedness
+Target number();
+
+// The disagreement on input, if there is one; an input the oracle rejects has none
+std::optional<std::string> disagreement(const Target &target, std::string_view input);
+
+/**
+ * The first regression whose answer differs from the one worked out by hand at any instruction
+ * set, or that the oracle disagrees with, if there is one. Regressions outside the inputs the
+ * oracle accepts only have their hand-worked answers to check.
+ */
+std::optional<std::string> checkRegressions(const Target &target);
+
+/**
+ * Removes blank line separated records, then lines, then shrinks numbers towards zero, for
+ * as long as the disagreement remains. Returns the smallest input found.
+ */
+std::string shrink(const Target &target, std::string input);
+
+}
@@ -0,0 +1,45 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <iostream>
+
+/**
+ * The libFuzzer entry point for one day, named by AOC_FUZZ_DAY. The fuzzer's bytes choose the
+ * seed and size of a generated input rather than being the input itself, so that every input
+ * it tries is valid and coverage guides it towards the engines rather than the parser.
+ */
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    static const auto target = fuzz::AOC_FUZZ_DAY();
+
+    uint64_t seed = 0;
+    std::memcpy(&seed, data, std::min(size, sizeof(seed)));
+    auto records = size > sizeof(seed) ? 1 + data[sizeof(seed)] % 64 : 1;
+    fuzz::Random random(seed);
+    auto input = target.generate(random, records);
+
+    if (auto what = target.compare(input)) {
+        std::cerr << std::format("{}: seed {}: {}\n", target.day, seed, *what);
+        std::cerr << std::format("--- shrunk input\n{}---", fuzz::shrink(target, input)) << std::endl;
+        std::abort();
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <algorithm>
+#include <format>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aoc/input.h"
+#include "aoc/number.h"
+
+/**
+ * Runs the differential tests of the given days, or of every day, and prints a minimal input
+ * for each disagreement it finds. The number target checks the shared integer parser.
+ *
+ *   fuzz [dayNN|number ...] [--runs=N] [--seed=N] [--size=N] [--replay=PATH]
+ *
+ * A day's regressions are checked first. Run i of a day then solves an input of up to --size
+ * records generated from seed + i, so a failing run can be repeated exactly. --replay checks
+ * and shrinks the given input instead.
+ */
+
+namespace {
+    void printDisagreement(const fuzz::Target &target, const std::string &input, const std::string &what) {
+        std::cout << std::format("{}: {}\n", target.day, what);
+        auto minimal = fuzz::shrink(target, input);
+        std::cout << std::format("{}: shrunk from {} to {} bytes, where {}\n--- input\n{}---\n", target.day,
+                                 input.size(), minimal.size(), fuzz::disagreement(target, minimal).value_or(what),
+                                 minimal);
+    }
+
+    // Returns whether every regression and run agreed
+    bool fuzzTarget(const fuzz::Target &target, uint64_t seed, size_t runs, size_t maxSize) {
+        if (auto what = fuzz::checkRegressions(target)) {
+            std::cout << std::format("{}: {}\n", target.day, *what);
+            return false;
+        }
+        for (size_t run = 0; run < runs; run++) {
+            fuzz::Random random(seed + run);
+            // Most bugs show up in small inputs, which are also quick, so sizes cycle upwards
+            auto size = 1 + run % maxSize;
+            auto input = target.generate(random, size);
+            std::optional<std::string> what;
+            try {
+                what = target.compare(input);
+            } catch (const std::exception &ex) {
+                std::cout << std::format("{}: the oracle rejected generated input {} with '{}'\n--- input\n{}---\n",
+                                         target.day, seed + run, ex.what(), input);
+                return false;
+            }
+            if (what) {
+                printDisagreement(target, input, std::format("seed {}: {}", seed + run, *what));
+                return false;
+            }
+        }
+        std::cout << std::format("{}: {} inputs agree{}\n", target.day, runs,
+                                 target.regressions.empty()
+                                     ? "" : std::format(", as do {} regressions", target.regressions.size()))
+                  << std::flush;
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+try {
+    std::vector<fuzz::Target> targets{fuzz::day11(), fuzz::day12(), fuzz::day13(), fuzz::day14(),
+                                      fuzz::day15(), fuzz::day16(), fuzz::day18(), fuzz::number()};
+    std::vector<fuzz::Target> chosen;
+    uint64_t seed = 2022;
+    size_t runs = 200;
+    size_t maxSize = 30;
+    std::optional<std::string> replay;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg.starts_with("--runs=")) {
+            runs = aoc::parseNumber<size_t>(arg.substr(7));
+        } else if (arg.starts_with("--seed=")) {
+            seed = aoc::parseNumber<uint64_t>(arg.substr(7));
+        } else if (arg.starts_with("--size=")) {
+            maxSize = std::max<size_t>(1, aoc::parseNumber<size_t>(arg.substr(7)));
+        } else if (arg.starts_with("--replay=")) {
+            replay = arg.substr(9);
+        } else {
+            auto it = std::find_if(targets.begin(), targets.end(), [&](const auto &t) { return t.day == arg; });
+            if (it == targets.end()) {
+                throw std::runtime_error(std::format("Unknown argument {}", arg));
+            }
+            chosen.push_back(*it);
+        }
+    }
+    if (chosen.empty()) {
+        chosen = targets;
+    }
+
+    if (replay) {
+        if (chosen.size() != 1) {
+            throw std::runtime_error("--replay needs the day it is an input for");
+        }
+        aoc::InputFile file(*replay);
+        auto input = std::string(file.contents());
+        if (auto what = chosen.front().compare(input)) {
+            printDisagreement(chosen.front(), input, *what);
+            return 1;
+        }
+        std::cout << std::format("{}: {} agrees\n", chosen.front().day, *replay);
+        return 0;
+    }
+
+    bool agreed = true;
+    for (const auto &target: chosen) {
+        agreed = fuzzTarget(target, seed, runs, maxSize) && agreed;
+    }
+    return agreed ? 0 : 1;
+} catch (const std::exception &ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,138 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "fuzz.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "aoc/number.h"
+
+namespace {
+    // The edges of every width parsed into, where overflow starts
+    std::vector<std::string> boundaries() {
+        std::vector<std::string> values{"0", "-0", "18446744073709551615", "18446744073709551616",
+                                        "9223372036854775807", "9223372036854775808", "-9223372036854775808",
+                                        "-9223372036854775809"};
+        for (int bits: {8, 16, 32}) {
+            auto max = (int64_t(1) << (bits - 1)) - 1;
+            for (auto value: {max, max + 1, -max - 1, -max - 2, 2 * max + 1, 2 * max + 2}) {
+                values.push_back(std::to_string(value));
+            }
+        }
+        return values;
+    }
+
+    std::string randomNumber(fuzz::Random &random) {
+        static const auto edges = boundaries();
+        if (random.chance(30)) {
+            return edges[random.below(edges.size())];
+        }
+        // Runs of eight or more digits are where the SWAR path hands over to from_chars
+        std::string number = random.chance(30) ? "-" : random.chance(5) ? "+" : "";
+        auto digits = 1 + random.below(24);
+        for (size_t i = 0; i < digits; i++) {
+            number += char('0' + random.below(10));
+        }
+        return number;
+    }
+
+    // What parse makes of text, which is copied to a buffer of exactly its size so that the
+    // sanitizers see any read past the end of it
+    template <std::integral T, typename Parse>
+    std::string outcome(std::string_view text, Parse parse) {
+        auto buffer = std::make_unique<char[]>(text.size());
+        std::copy(text.begin(), text.end(), buffer.get());
+        try {
+            auto [value, length] = parse(std::string_view(buffer.get(), text.size()));
+            if constexpr (std::is_signed_v<T>) {
+                return std::format("{} from {} characters", int64_t(value), length);
+            } else {
+                return std::format("{} from {} characters", uint64_t(value), length);
+            }
+        } catch (const std::runtime_error &) {
+            return "no number";
+        }
+    }
+
+    // Checks every start of line against std::from_chars itself, for one width
+    template <std::integral T>
+    std::optional<std::string> compareWidth(std::string_view line) {
+        for (size_t start = 0; start < line.size(); start++) {
+            auto text = line.substr(start);
+            auto expected = outcome<T>(text, [](std::string_view str) {
+                T value{};
+                auto [end, error] = std::from_chars(str.data(), str.data() + str.size(), value);
+                if (error != std::errc{}) {
+                    throw std::runtime_error("no number");
+                }
+                return aoc::ParseResult<T>{value, size_t(end - str.data())};
+            });
+            auto actual = outcome<T>(text, aoc::parseIntegerSwar<T>);
+            if (actual != expected) {
+                return std::format("parseIntegerSwar<{}{}>('{}') gave {} but from_chars gave {}",
+                                   std::is_signed_v<T> ? "int" : "uint", 8 * sizeof(T), text, actual, expected);
+            }
+        }
+        return std::nullopt;
+    }
+}
+
+fuzz::Target fuzz::number() {
+    // Each line is a number with what might follow it in an input, which decides whether there
+    // are eight bytes to read at once
+    auto generate = [](Random &random, size_t size) {
+        constexpr std::string_view Separators[] = {"", ",", ", ", " -> ", ": closest", "-", "x"};
+        std::string input;
+        for (size_t i = 0; i < size; i++) {
+            input += randomNumber(random);
+            for (auto parts = random.below(3); parts > 0; parts--) {
+                input += Separators[random.below(std::size(Separators))];
+                if (random.chance(50)) {
+                    input += randomNumber(random);
+                }
+            }
+            input += '\n';
+        }
+        return input;
+    };
+
+    // Every width and signedness, at every position of each line
+    auto compare = [](std::string_view input) -> std::optional<std::string> {
+        for (size_t start = 0; start < input.size();) {
+            auto end = std::min(input.find('\n', start), input.size());
+            auto line = input.substr(start, end - start);
+            start = end + 1;
+            for (auto what: {compareWidth<int8_t>(line), compareWidth<uint8_t>(line), compareWidth<int16_t>(line),
+                             compareWidth<uint16_t>(line), compareWidth<int32_t>(line),
+                             compareWidth<uint32_t>(line), compareWidth<int64_t>(line),
+                             compareWidth<uint64_t>(line)}) {
+                if (what) {
+                    return what;
+                }
+            }
+        }
+        return std::nullopt;
+    };
+    return {"number", generate, compare};
+}
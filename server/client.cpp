@@ -0,0 +1,95 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include <iostream>
+#include <filesystem>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "protocol.h"
+#include "aoc/input.h"
+
+/**
+ * Sends one input to a running aocd and prints the answer, exactly as the day's own
+ * executable would. Inputs are sent by path for the daemon to open, unless --inline is given
+ * or the input is "-" for standard input.
+ *
+ *   aoc-client [--socket=PATH] [--inline] DAY INPUT [name=value]...
+ *
+ * e.g. aoc-client day15 input/day15.txt row=2000000, or day18 ... engine=bitwise pockets.
+ * A parameter without a value is a flag that is turned on.
+ */
+
+int main(int argc, char **argv)
+try {
+    std::string socketPath;
+    bool sendInline = false;
+    int i = 1;
+    for (; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg.starts_with("--socket=")) {
+            socketPath = arg.substr(9);
+        } else if (arg == "--inline") {
+            sendInline = true;
+        } else {
+            break;
+        }
+    }
+    if (argc - i < 2) {
+        std::cerr << "Usage: aoc-client [--socket=PATH] [--inline] DAY INPUT [name=value]..." << std::endl;
+        return 1;
+    }
+
+    server::Request request;
+    request.day = argv[i];
+    std::string input = argv[i + 1];
+    if (sendInline || input == "-") {
+        aoc::InputFile file(input);
+        if (file.contents().size() > server::MaxPayloadSize) {
+            throw std::runtime_error(std::format("{} is too large to send inline; send it by path instead", input));
+        }
+        request.payload.emplace(file.contents());
+    } else {
+        // The daemon has its own working directory
+        request.parameters.emplace_back("file", std::filesystem::absolute(input).string());
+    }
+    for (i += 2; i < argc; i++) {
+        std::string_view arg = argv[i];
+        auto equals = arg.find('=');
+        if (equals == std::string_view::npos) {
+            request.parameters.emplace_back(arg, "");
+        } else {
+            request.parameters.emplace_back(arg.substr(0, equals), arg.substr(equals + 1));
+        }
+    }
+
+    if (socketPath.empty()) {
+        socketPath = server::defaultSocket();
+    }
+    auto connection = server::Connection::connect(socketPath);
+    server::writeRequest(connection, request);
+    auto response = server::readResponse(connection);
+    if (!response.ok) {
+        std::cerr << "ERROR: " << response.body << std::endl;
+        return 1;
+    }
+    std::cout << response.body << std::flush;
+    return 0;
+} catch (const std::exception &ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
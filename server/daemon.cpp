@@ -0,0 +1,255 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include <iostream>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "protocol.h"
+#include "solvers.h"
+#include "aoc/cpu.h"
+#include "aoc/number.h"
+#include "aoc/thread_pool.h"
+
+/**
+ * Keeps every day's solver resident and answers requests for them over a Unix domain socket,
+ * so that repeated runs pay neither process startup nor, for an input seen recently, parsing.
+ * The main thread polls the open connections and hands one to a thread of a pool only once a
+ * request arrives on it, so idle clients hold no thread; see protocol.h for the wire format
+ * and aoc-client for a command line client.
+ *
+ *   aocd [--socket=PATH] [--threads=N] [--cache=ENTRIES] [--isa=scalar|sse4.2|avx2|avx512]
+ *
+ * SIGINT or SIGTERM stop it accepting connections and close the idle ones; requests already
+ * received are answered first.
+ */
+
+namespace {
+    using ConnectionPtr = std::shared_ptr<server::Connection>;
+
+    /**
+     * Polls the listener and the idle connections, buffering what arrives until a whole request
+     * has, and only then serving it on the pool, so that no worker ever waits on a client.
+     * Workers hand a connection back once it has been answered, waking the poll through a
+     * pipe, which is also how the signal thread stops it.
+     */
+    class Dispatcher {
+        server::Solvers &solvers;
+        server::Listener &listener;
+        int wakeRead;
+        int wakeWrite;
+
+        std::mutex mutex;
+        std::vector<ConnectionPtr> answered;
+        bool stopping = false;
+
+        void wake() noexcept {
+            char byte = 0;
+            // A full pipe already has a wakeup pending
+            [[maybe_unused]] auto ignored = ::write(wakeWrite, &byte, 1);
+        }
+
+        // Tells a client that broke the protocol why, in case it is still reading, then drops it
+        static void reject(server::Connection &connection, const std::exception &ex) noexcept {
+            std::cerr << "Dropped connection: " << ex.what() << std::endl;
+            try {
+                server::writeResponse(connection, {false, ex.what()});
+            } catch (const std::exception &) {
+                // The client has gone away, so there is no one to tell
+            }
+        }
+
+        void serve(const ConnectionPtr &connection) {
+            try {
+                // A client may send its next request before reading this reply, and what is
+                // already buffered would never wake the poll
+                do {
+                    auto request = server::readRequest(*connection);
+                    if (!request) {
+                        return;
+                    }
+                    server::Response response;
+                    try {
+                        response.body = solvers.solve(*request);
+                        response.ok = true;
+                    } catch (const std::exception &ex) {
+                        response.body = ex.what();
+                    }
+                    server::writeResponse(*connection, response);
+                } while (server::holdsRequest(connection->pending()));
+            } catch (const std::exception &ex) {
+                reject(*connection, ex);
+                return;
+            }
+            std::lock_guard lock(mutex);
+            if (!stopping) {
+                answered.push_back(connection);
+                wake();
+            }
+        }
+
+    public:
+        Dispatcher(server::Solvers &solvers, server::Listener &listener) : solvers(solvers), listener(listener) {
+            int fds[2];
+            if (::pipe2(fds, O_CLOEXEC | O_NONBLOCK) != 0) {
+                throw std::runtime_error(std::format("Failed to create pipe: {}", std::strerror(errno)));
+            }
+            wakeRead = fds[0];
+            wakeWrite = fds[1];
+        }
+
+        ~Dispatcher() {
+            ::close(wakeRead);
+            ::close(wakeWrite);
+        }
+
+        Dispatcher(const Dispatcher &) = delete;
+        Dispatcher &operator=(const Dispatcher &) = delete;
+
+        // Safe to call from any thread
+        void stop() noexcept {
+            std::lock_guard lock(mutex);
+            stopping = true;
+            wake();
+        }
+
+        void run(aoc::ThreadPool &pool) {
+            std::vector<ConnectionPtr> idle;
+            std::vector<pollfd> polled;
+            while (true) {
+                polled.assign({{listener.descriptor(), POLLIN, 0}, {wakeRead, POLLIN, 0}});
+                for (const auto &connection: idle) {
+                    polled.push_back({connection->descriptor(), POLLIN, 0});
+                }
+                if (::poll(polled.data(), polled.size(), -1) < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::runtime_error(std::format("Failed to poll: {}", std::strerror(errno)));
+                }
+
+                if (polled[1].revents != 0) {
+                    char bytes[64];
+                    while (::read(wakeRead, bytes, sizeof(bytes)) > 0) {}
+                    std::lock_guard lock(mutex);
+                    if (stopping) {
+                        break;
+                    }
+                    idle.insert(idle.end(), answered.begin(), answered.end());
+                    answered.clear();
+                }
+
+                size_t kept = 0;
+                for (size_t i = 0; i < idle.size(); i++) {
+                    auto &connection = idle[i];
+                    if (i + 2 < polled.size() && polled[i + 2].revents != 0) {
+                        try {
+                            // Once the peer has hung up, the worker reports how it left off
+                            if (!connection->receive() || server::holdsRequest(connection->pending())) {
+                                pool.submit([this, connection] { serve(connection); });
+                                continue;
+                            }
+                        } catch (const std::exception &ex) {
+                            // Nothing more is read from it, and the reply may block, so it is
+                            // sent from the pool
+                            pool.submit([connection, error = std::runtime_error(ex.what())] {
+                                reject(*connection, error);
+                            });
+                            continue;
+                        }
+                    }
+                    idle[kept++] = std::move(connection);
+                }
+                idle.resize(kept);
+
+                if (polled[0].revents != 0) {
+                    int fd;
+                    while ((fd = listener.accept()) >= 0) {
+                        idle.push_back(std::make_shared<server::Connection>(fd));
+                    }
+                }
+            }
+
+            for (const auto &connection: idle) {
+                connection->shutdownReads();
+            }
+        }
+    };
+}
+
+int main(int argc, char **argv)
+try {
+    std::string socketPath;
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t cacheEntries = 64;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg.starts_with("--socket=")) {
+            socketPath = arg.substr(9);
+        } else if (arg.starts_with("--threads=")) {
+            threads = std::max<size_t>(1, aoc::parseNumber<size_t>(arg.substr(10)));
+        } else if (arg.starts_with("--cache=")) {
+            cacheEntries = aoc::parseNumber<size_t>(arg.substr(8));
+        } else if (arg.starts_with("--isa=")) {
+            aoc::cpu::select(aoc::cpu::parseIsa(arg.substr(6)));
+        } else {
+            throw std::runtime_error(std::format("Unknown argument {}", arg));
+        }
+    }
+
+    if (socketPath.empty()) {
+        socketPath = server::defaultSocket();
+    }
+
+    // Every thread started from here on inherits the blocked signals, so only sigwait sees them
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    server::Solvers solvers(cacheEntries);
+    server::Listener listener(socketPath);
+    Dispatcher dispatcher(solvers, listener);
+    std::thread([&] {
+        int signal;
+        sigwait(&signals, &signal);
+        dispatcher.stop();
+    }).detach();
+
+    std::cerr << std::format("Listening on {} with {} threads", socketPath, threads) << std::endl;
+    {
+        aoc::ThreadPool pool(threads);
+        dispatcher.run(pool);
+    }
+    return 0;
+} catch (const std::exception &ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
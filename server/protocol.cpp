@@ -0,0 +1,384 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "protocol.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "aoc/number.h"
+
+namespace server {
+
+namespace {
+    // Nothing legitimate comes close; this only stops a confused peer exhausting memory
+    constexpr size_t MaxLineLength = 1 << 16;
+
+    sockaddr_un addressOf(const std::string &path) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error(std::format("Socket path is too long: {}", path));
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return address;
+    }
+
+    [[noreturn]] void fail(std::string_view what) {
+        throw std::runtime_error(std::format("{}: {}", what, std::strerror(errno)));
+    }
+
+    void checkPayloadSize(size_t size) {
+        if (size > MaxPayloadSize) {
+            throw std::runtime_error(std::format("Input of {} bytes is over the limit of {}", size, MaxPayloadSize));
+        }
+    }
+
+    void checkHeaderSize(size_t size) {
+        if (size > MaxHeaderSize) {
+            throw std::runtime_error(std::format("Request header is over the limit of {} bytes", MaxHeaderSize));
+        }
+    }
+}
+
+std::string defaultSocket() {
+    auto runtimeDirectory = std::getenv("XDG_RUNTIME_DIR");
+    if (runtimeDirectory != nullptr && *runtimeDirectory != '\0') {
+        return std::format("{}/aocd.sock", runtimeDirectory);
+    }
+
+    // Anyone can create the directory first, so it is only trusted once it is seen to be ours
+    auto directory = std::format("/tmp/aocd-{}", ::geteuid());
+    if (::mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST) {
+        fail(std::format("Failed to create {}", directory));
+    }
+    struct stat status{};
+    if (::lstat(directory.c_str(), &status) != 0) {
+        fail(std::format("Failed to examine {}", directory));
+    }
+    if (!S_ISDIR(status.st_mode) || status.st_uid != ::geteuid() || (status.st_mode & 077) != 0) {
+        throw std::runtime_error(std::format("{} is not a directory private to this user", directory));
+    }
+    return directory + "/aocd.sock";
+}
+
+Connection::~Connection() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+Connection Connection::connect(const std::string &path) {
+    auto address = addressOf(path);
+    auto fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        fail("Failed to create socket");
+    }
+    Connection connection(fd);
+    if (::connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+        fail(std::format("Failed to connect to {}", path));
+    }
+    return connection;
+}
+
+bool Connection::fill() {
+    if (offset > 0) {
+        buffer.erase(0, offset);
+        offset = 0;
+    }
+    char chunk[1 << 16];
+    while (true) {
+        auto count = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (count > 0) {
+            buffer.append(chunk, size_t(count));
+            return true;
+        }
+        if (count == 0) {
+            return false;
+        }
+        if (errno != EINTR) {
+            fail("Failed to read from socket");
+        }
+    }
+}
+
+bool Connection::receive() {
+    if (offset > 0) {
+        buffer.erase(0, offset);
+        offset = 0;
+    }
+    char chunk[1 << 16];
+    while (buffer.size() <= MaxHeaderSize + MaxPayloadSize) {
+        auto count = ::recv(fd, chunk, sizeof(chunk), MSG_DONTWAIT);
+        if (count > 0) {
+            buffer.append(chunk, size_t(count));
+        } else if (count == 0) {
+            return false;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return true;
+        } else if (errno != EINTR) {
+            fail("Failed to read from socket");
+        }
+    }
+    return true;
+}
+
+void Connection::shutdownReads() noexcept {
+    ::shutdown(fd, SHUT_RD);
+}
+
+bool Connection::readLine(std::string &line) {
+    size_t newline;
+    while ((newline = buffer.find('\n', offset)) == std::string::npos) {
+        if (buffer.size() - offset > MaxLineLength) {
+            throw std::runtime_error("Line too long");
+        }
+        if (!fill()) {
+            if (offset == buffer.size()) {
+                return false;
+            }
+            throw std::runtime_error("Connection closed part way through a line");
+        }
+    }
+    line.assign(buffer, offset, newline - offset);
+    offset = newline + 1;
+    return true;
+}
+
+std::string Connection::readBytes(size_t count) {
+    while (buffer.size() - offset < count) {
+        if (!fill()) {
+            throw std::runtime_error(std::format("Connection closed with {} of {} bytes read",
+                                                 buffer.size() - offset, count));
+        }
+    }
+    auto bytes = buffer.substr(offset, count);
+    offset += count;
+    return bytes;
+}
+
+void Connection::write(std::string_view bytes) {
+    while (!bytes.empty()) {
+        // A peer that has gone away is reported as EPIPE rather than killing the process
+        auto count = ::send(fd, bytes.data(), bytes.size(), MSG_NOSIGNAL);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            fail("Failed to write to socket");
+        }
+        bytes.remove_prefix(size_t(count));
+    }
+}
+
+Listener::Listener(std::string socketPath) : path(std::move(socketPath)) {
+    auto address = addressOf(path);
+
+    // Only a socket is ever removed, and only once no daemon answers on it
+    struct stat status{};
+    if (::lstat(path.c_str(), &status) == 0) {
+        if (!S_ISSOCK(status.st_mode)) {
+            throw std::runtime_error(std::format("{} exists and is not a socket", path));
+        }
+        auto probe = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (probe < 0) {
+            fail("Failed to create socket");
+        }
+        auto answered = ::connect(probe, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0;
+        auto error = errno;
+        ::close(probe);
+        if (answered) {
+            throw std::runtime_error(std::format("Another daemon is already listening on {}", path));
+        }
+        if (error != ECONNREFUSED) {
+            errno = error;
+            fail(std::format("Failed to check for a daemon on {}", path));
+        }
+        ::unlink(path.c_str());
+    } else if (errno != ENOENT) {
+        fail(std::format("Failed to examine {}", path));
+    }
+
+    fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+    if (fd < 0) {
+        fail("Failed to create socket");
+    }
+    if (::bind(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+        auto error = errno;
+        ::close(fd);
+        errno = error;
+        fail(std::format("Failed to bind {}", path));
+    }
+    if (::chmod(path.c_str(), 0600) != 0) {
+        auto error = errno;
+        ::close(fd);
+        ::unlink(path.c_str());
+        errno = error;
+        fail(std::format("Failed to restrict {}", path));
+    }
+    if (::listen(fd, SOMAXCONN) != 0) {
+        auto error = errno;
+        ::close(fd);
+        ::unlink(path.c_str());
+        errno = error;
+        fail(std::format("Failed to listen on {}", path));
+    }
+}
+
+Listener::~Listener() {
+    ::close(fd);
+    ::unlink(path.c_str());
+}
+
+int Listener::accept() {
+    while (true) {
+        auto client = ::accept4(fd, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client >= 0) {
+            // The socket's mode is the real guard, but a --socket path may be somewhere shared
+            ucred peer{};
+            socklen_t size = sizeof(peer);
+            if (::getsockopt(client, SOL_SOCKET, SO_PEERCRED, &peer, &size) == 0 && peer.uid == ::geteuid()) {
+                return client;
+            }
+            ::close(client);
+            continue;
+        }
+        // A connection the client gave up on before it was accepted is not an error
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNABORTED) {
+            return -1;
+        }
+        if (errno != EINTR) {
+            fail("Failed to accept connection");
+        }
+    }
+}
+
+std::optional<Request> readRequest(Connection &connection) {
+    Request request;
+    if (!connection.readLine(request.day)) {
+        return std::nullopt;
+    }
+    if (request.day.empty()) {
+        throw std::runtime_error("Request has no day");
+    }
+
+    std::optional<size_t> payloadSize;
+    std::string line;
+    size_t headerSize = request.day.size() + 1;
+    while (true) {
+        if (!connection.readLine(line)) {
+            throw std::runtime_error("Connection closed part way through a request");
+        }
+        headerSize += line.size() + 1;
+        checkHeaderSize(headerSize);
+        if (line.empty()) {
+            break;
+        }
+        auto equals = line.find('=');
+        if (equals == std::string::npos) {
+            throw std::runtime_error(std::format("Expected name=value but got '{}'", line));
+        }
+        if (line.compare(0, equals, "bytes") == 0) {
+            payloadSize = aoc::parseNumber<size_t>(std::string_view(line).substr(equals + 1));
+            checkPayloadSize(*payloadSize);
+        } else {
+            request.parameters.emplace_back(line.substr(0, equals), line.substr(equals + 1));
+        }
+    }
+    if (payloadSize) {
+        request.payload = connection.readBytes(*payloadSize);
+    }
+    return request;
+}
+
+bool holdsRequest(std::string_view bytes) {
+    std::optional<size_t> payloadSize;
+    size_t start = 0;
+    while (true) {
+        auto newline = bytes.find('\n', start);
+        if (newline == std::string_view::npos) {
+            if (bytes.size() - start > MaxLineLength) {
+                throw std::runtime_error("Line too long");
+            }
+            checkHeaderSize(bytes.size());
+            return false;
+        }
+        checkHeaderSize(newline + 1);
+        auto line = bytes.substr(start, newline - start);
+        // The first line names the day; an empty one is rejected as soon as it is read
+        bool first = start == 0;
+        start = newline + 1;
+        if (line.empty()) {
+            if (first) {
+                return true;
+            }
+            break;
+        }
+        if (!first && line.starts_with("bytes=")) {
+            payloadSize = aoc::parseNumber<size_t>(line.substr(6));
+            checkPayloadSize(*payloadSize);
+        }
+    }
+    return bytes.size() - start >= payloadSize.value_or(0);
+}
+
+void writeRequest(Connection &connection, const Request &request) {
+    auto header = request.day + '\n';
+    for (const auto &[name, value]: request.parameters) {
+        header += std::format("{}={}\n", name, value);
+    }
+    if (request.payload) {
+        header += std::format("bytes={}\n", request.payload->size());
+    }
+    header += '\n';
+    connection.write(header);
+    if (request.payload) {
+        connection.write(*request.payload);
+    }
+}
+
+Response readResponse(Connection &connection) {
+    std::string line;
+    if (!connection.readLine(line)) {
+        throw std::runtime_error("Connection closed without a response");
+    }
+    Response response;
+    std::string_view size;
+    if (line.starts_with("ok ")) {
+        response.ok = true;
+        size = std::string_view(line).substr(3);
+    } else if (line.starts_with("error ")) {
+        size = std::string_view(line).substr(6);
+    } else {
+        throw std::runtime_error(std::format("Malformed response '{}'", line));
+    }
+    response.body = connection.readBytes(aoc::parseNumber<size_t>(size));
+    return response;
+}
+
+void writeResponse(Connection &connection, const Response &response) {
+    connection.write(std::format("{} {}\n", response.ok ? "ok" : "error", response.body.size()));
+    connection.write(response.body);
+}
+
+}
@@ -0,0 +1,161 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * The wire format between the solver daemon and its clients, over a Unix domain socket.
+ *
+ * A request is the name of a day on a line of its own, then one name=value parameter per
+ * line, then a blank line. The input is either named by a file parameter, which the daemon
+ * opens itself, or sent inline: a bytes=N parameter says that N bytes of input follow the
+ * blank line. For example
+ *
+ *   day15\n
+ *   row=2000000\n
+ *   bytes=1234\n
+ *   \n
+ *   <1234 bytes>
+ *
+ * The reply is "ok N" or "error N" on a line, followed by N bytes of body: what the day's
+ * executable would print for the input, or why it could not be solved. A connection may
+ * carry any number of requests one after another. A request whose header or payload is
+ * larger than the limits below gets an error reply, and nothing more is read from its
+ * connection.
+ */
+
+namespace server {
+
+// Far beyond any real request's parameters, but small enough to buffer without a second thought
+constexpr size_t MaxHeaderSize = size_t(1) << 20;
+// Room for the largest inputs the generator writes, e.g. day18 --size=200
+constexpr size_t MaxPayloadSize = size_t(1) << 30;
+
+/**
+ * $XDG_RUNTIME_DIR/aocd.sock, or failing that aocd.sock in a directory under /tmp that only
+ * the user can enter, which is created if need be. Throws if that directory exists but
+ * belongs to someone else or is open to them.
+ */
+std::string defaultSocket();
+
+struct Request {
+    std::string day;
+    std::vector<std::pair<std::string, std::string>> parameters;
+    // The input itself, when it is sent inline rather than named by a file parameter
+    std::optional<std::string> payload;
+};
+
+struct Response {
+    bool ok = false;
+    std::string body;
+};
+
+/**
+ * One end of a stream socket, with buffered reads. Throws on any I/O error; a peer closing
+ * the connection is only expected between requests.
+ */
+class Connection {
+    int fd;
+    std::string buffer;
+    size_t offset = 0;
+
+    // Reads more into the buffer, returning false at the end of the stream
+    bool fill();
+
+public:
+    explicit Connection(int fd) noexcept : fd(fd) {}
+    ~Connection();
+
+    Connection(Connection &&other) noexcept
+            : fd(std::exchange(other.fd, -1)), buffer(std::move(other.buffer)), offset(other.offset) {}
+
+    Connection(const Connection &) = delete;
+    Connection &operator=(const Connection &) = delete;
+
+    static Connection connect(const std::string &path);
+
+    [[nodiscard]] int descriptor() const noexcept { return fd; }
+
+    // What the peer has sent that has been read from the socket but not yet consumed
+    [[nodiscard]] std::string_view pending() const noexcept {
+        return std::string_view(buffer).substr(offset);
+    }
+
+    /**
+     * Buffers whatever the peer has sent without waiting for more, returning false if the
+     * stream has ended. Stops short once more than the largest request is pending, which
+     * holdsRequest then either finds whole or rejects.
+     */
+    bool receive();
+
+    // Ends any read in progress and any after it, as if the peer had closed the connection
+    void shutdownReads() noexcept;
+
+    // Returns false if the stream ended before any of the line was read
+    bool readLine(std::string &line);
+
+    std::string readBytes(size_t count);
+
+    void write(std::string_view bytes);
+};
+
+/**
+ * A listening Unix domain socket that only the user can connect to, removed again when it is
+ * destroyed. A stale socket left behind by a daemon that did not shut down cleanly is
+ * replaced, but anything else at the path, or a socket that a daemon still answers on, is
+ * an error. The socket never blocks, so wait for connections on its descriptor with poll.
+ */
+class Listener {
+    int fd;
+    std::string path;
+
+public:
+    explicit Listener(std::string path);
+    ~Listener();
+
+    Listener(const Listener &) = delete;
+    Listener &operator=(const Listener &) = delete;
+
+    [[nodiscard]] int descriptor() const noexcept { return fd; }
+
+    /**
+     * Returns the descriptor of the next pending connection, or -1 if there is none.
+     * Connections from other users are closed without being returned.
+     */
+    int accept();
+};
+
+// Returns nothing if the connection was closed cleanly instead
+std::optional<Request> readRequest(Connection &connection);
+
+/**
+ * Whether bytes hold the whole of a request, payload and all, so that reading it cannot wait
+ * on the peer. Throws if they cannot be the start of a valid one, including one that would
+ * be over the size limits.
+ */
+bool holdsRequest(std::string_view bytes);
+void writeRequest(Connection &connection, const Request &request);
+
+Response readResponse(Connection &connection);
+void writeResponse(Connection &connection, const Response &response);
+
+}
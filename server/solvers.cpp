@@ -0,0 +1,266 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "solvers.h"
+
+#include <algorithm>
+#include <format>
+#include <optional>
+#include <stdexcept>
+
+#include "aoc/hash.h"
+#include "aoc/input.h"
+#include "aoc/number.h"
+
+#include "day11.h"
+#include "day12.h"
+#include "day13.h"
+#include "day14.h"
+#include "day15.h"
+#include "day16.h"
+#include "day18.h"
+
+namespace server {
+
+Parameters::Parameters(const std::vector<std::pair<std::string, std::string>> &parameters) {
+    for (const auto &[name, value]: parameters) {
+        if (!values.emplace(name, value).second) {
+            throw std::runtime_error(std::format("Parameter {} given more than once", name));
+        }
+    }
+}
+
+const std::string *Parameters::find(std::string_view name) {
+    used.emplace_back(name);
+    auto it = values.find(name);
+    return it == values.end() ? nullptr : &it->second;
+}
+
+std::string_view Parameters::text(std::string_view name) {
+    const auto *value = find(name);
+    if (!value) {
+        throw std::runtime_error(std::format("Missing parameter {}", name));
+    }
+    return *value;
+}
+
+std::string_view Parameters::text(std::string_view name, std::string_view fallback) {
+    const auto *value = find(name);
+    return value ? std::string_view(*value) : fallback;
+}
+
+template <typename T>
+T Parameters::number(std::string_view name) {
+    return aoc::parseNumber<T>(text(name));
+}
+
+template <typename T>
+T Parameters::number(std::string_view name, T fallback) {
+    const auto *value = find(name);
+    return value ? aoc::parseNumber<T>(*value) : fallback;
+}
+
+bool Parameters::flag(std::string_view name) {
+    const auto *value = find(name);
+    if (!value || *value == "false" || *value == "0") {
+        return false;
+    }
+    if (value->empty() || *value == "true" || *value == "1") {
+        return true;
+    }
+    throw std::runtime_error(std::format("{} must be true or false, not '{}'", name, *value));
+}
+
+void Parameters::checkAllUsed() const {
+    for (const auto &[name, _]: values) {
+        if (std::find(used.begin(), used.end(), name) == used.end()) {
+            throw std::runtime_error(std::format("Unknown parameter {}", name));
+        }
+    }
+}
+
+namespace {
+    template <typename T>
+    std::shared_ptr<const void> share(T parsed) {
+        return std::make_shared<const T>(std::move(parsed));
+    }
+
+    template <typename T>
+    const T &as(const void *parsed) {
+        return *static_cast<const T *>(parsed);
+    }
+
+    const std::vector<Day> Days{
+        {
+            "day11",
+            [](std::string_view input) { return share(day11::parseMonkeys(input)); },
+            [](const void *parsed, Parameters &parameters) {
+                parameters.checkAllUsed();
+                return day11::report(day11::solve(as<std::vector<day11::Monkey>>(parsed)));
+            },
+        },
+        {
+            // The distances to the end are worked out when the mountain is built, so are cached with it
+            "day12",
+            [](std::string_view input) -> std::shared_ptr<const void> {
+                return std::make_shared<const day12::Mountain>(input);
+            },
+            [](const void *parsed, Parameters &parameters) {
+                parameters.checkAllUsed();
+                return day12::report(day12::solve(as<day12::Mountain>(parsed)));
+            },
+        },
+        {
+            "day13",
+            [](std::string_view input) { return share(day13::parseInput(input)); },
+            [](const void *parsed, Parameters &parameters) {
+                parameters.checkAllUsed();
+                return day13::report(day13::solve(as<day13::PacketPairs>(parsed)));
+            },
+        },
+        {
+            "day14",
+            [](std::string_view input) { return share(day14::parse(input)); },
+            [](const void *parsed, Parameters &parameters) {
+                parameters.checkAllUsed();
+                return day14::report(day14::pourSand(as<day14::OccupiedSpots>(parsed)));
+            },
+        },
+        {
+            "day15",
+            [](std::string_view input) { return share(day15::parse(input)); },
+            [](const void *parsed, Parameters &parameters) {
+                auto row = parameters.number<int>("row");
+                parameters.checkAllUsed();
+                return day15::report(day15::solve(as<std::vector<day15::Sensor>>(parsed), row));
+            },
+        },
+        {
+            "day16",
+            [](std::string_view input) { return share(day16::parse(input)); },
+            [](const void *parsed, Parameters &parameters) {
+                auto engineName = parameters.text("engine", "search");
+                parameters.checkAllUsed();
+                day16::Engine engine;
+                if (engineName == "search") {
+                    engine = day16::Engine::Search;
+                } else if (engineName == "dp") {
+                    engine = day16::Engine::Table;
+                } else {
+                    throw std::runtime_error(std::format("Unknown engine {}", engineName));
+                }
+                return day16::report(day16::solve(as<day16::ValveNetwork>(parsed), engine));
+            },
+        },
+        {
+            "day18",
+            [](std::string_view input) { return share(day18::ingest(input, 1)); },
+            [](const void *parsed, Parameters &parameters) {
+                // The daemon runs requests side by side, so each one is single threaded unless asked otherwise
+                day18::Options options;
+                auto engineName = parameters.text("engine", "queue");
+                auto storageName = parameters.text("storage", "auto");
+                options.threads = std::max<size_t>(1, parameters.number<size_t>("threads", 1));
+                options.incremental = parameters.flag("incremental");
+                options.verify = parameters.flag("verify");
+                options.pockets = parameters.flag("pockets");
+                parameters.checkAllUsed();
+
+                if (engineName == "set") {
+                    options.useSets = true;
+                } else if (engineName == "queue") {
+                    options.engine = day18::FloodEngine::Queue;
+                } else if (engineName == "bitwise") {
+                    options.engine = day18::FloodEngine::Bitwise;
+                } else {
+                    throw std::runtime_error(std::format("Unknown engine {}", engineName));
+                }
+                if (storageName == "auto") {
+                    options.storage = day18::Storage::Auto;
+                } else if (storageName == "dense") {
+                    options.storage = day18::Storage::Dense;
+                } else if (storageName == "sparse") {
+                    options.storage = day18::Storage::Sparse;
+                } else {
+                    throw std::runtime_error(std::format("Unknown storage {}", storageName));
+                }
+                return day18::report(day18::solve(as<std::vector<day18::Cube>>(parsed), options));
+            },
+        },
+    };
+}
+
+const std::vector<Day> &allDays() {
+    return Days;
+}
+
+std::shared_ptr<const void> InputCache::get(const Day &day, std::string_view input) {
+    Key key{day.name, aoc::hashBytes(input), input.size()};
+    {
+        std::lock_guard lock(mutex);
+        auto it = index.find(key);
+        if (it != index.end()) {
+            entries.splice(entries.begin(), entries, it->second);
+            return it->second->second;
+        }
+    }
+
+    // Parse outside the lock so that other requests are not held up behind it
+    auto parsed = day.parse(input);
+    if (capacity == 0) {
+        return parsed;
+    }
+
+    std::lock_guard lock(mutex);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        it->second->second = parsed;
+        entries.splice(entries.begin(), entries, it->second);
+        return parsed;
+    }
+    entries.emplace_front(key, parsed);
+    index.emplace(key, entries.begin());
+    if (entries.size() > capacity) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+    return parsed;
+}
+
+std::string Solvers::solve(const Request &request) {
+    const auto &days = allDays();
+    auto day = std::find_if(days.begin(), days.end(), [&](const Day &d) { return d.name == request.day; });
+    if (day == days.end()) {
+        throw std::runtime_error(std::format("Unknown day {}", request.day));
+    }
+
+    Parameters parameters(request.parameters);
+    std::optional<aoc::InputFile> file;
+    std::string_view input;
+    if (request.payload) {
+        if (parameters.has("file")) {
+            throw std::runtime_error("A request can have a file or an inline input, not both");
+        }
+        input = *request.payload;
+    } else {
+        file.emplace(std::string(parameters.text("file")));
+        input = file->contents();
+    }
+
+    auto parsed = cache.get(*day, input);
+    return day->solve(parsed.get(), parameters);
+}
+
+}
@@ -0,0 +1,115 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "protocol.h"
+
+namespace server {
+
+/**
+ * The name=value parameters of a request. Every parameter a solver asks for is marked as
+ * used, so that misspelt ones can be reported before any solving is done.
+ */
+class Parameters {
+    std::map<std::string, std::string, std::less<>> values;
+    std::vector<std::string> used;
+
+    const std::string *find(std::string_view name);
+
+public:
+    explicit Parameters(const std::vector<std::pair<std::string, std::string>> &parameters);
+
+    [[nodiscard]] bool has(std::string_view name) const { return values.contains(name); }
+
+    // Throws if the parameter was not given
+    std::string_view text(std::string_view name);
+    std::string_view text(std::string_view name, std::string_view fallback);
+
+    template <typename T>
+    T number(std::string_view name);
+    template <typename T>
+    T number(std::string_view name, T fallback);
+
+    // An empty value, "true" or "1" turn a flag on, "false" or "0" turn it off
+    bool flag(std::string_view name);
+
+    void checkAllUsed() const;
+};
+
+/**
+ * A day the daemon can solve: how to parse an input into the form that is cached, and how to
+ * solve that form for some parameters, producing what the day's executable prints.
+ */
+struct Day {
+    std::string_view name;
+    std::shared_ptr<const void> (*parse)(std::string_view input);
+    std::string (*solve)(const void *parsed, Parameters &parameters);
+};
+
+const std::vector<Day> &allDays();
+
+/**
+ * Parsed inputs by day and content hash, evicting the least recently used beyond a fixed
+ * number of entries. The length is part of the key as a cheap guard against collisions.
+ */
+class InputCache {
+    struct Key {
+        std::string_view day;
+        uint64_t hash = 0;
+        size_t size = 0;
+
+        auto operator<=>(const Key &) const = default;
+    };
+
+    using Entry = std::pair<Key, std::shared_ptr<const void>>;
+
+    size_t capacity;
+    std::mutex mutex;
+    // Most recently used first
+    std::list<Entry> entries;
+    std::map<Key, std::list<Entry>::iterator> index;
+
+public:
+    explicit InputCache(size_t capacity) : capacity(capacity) {}
+
+    /**
+     * Returns the parsed form of an input, parsing it if it is not already cached. Two
+     * requests for the same new input may both parse it; the second result wins.
+     */
+    std::shared_ptr<const void> get(const Day &day, std::string_view input);
+};
+
+class Solvers {
+    InputCache cache;
+
+public:
+    explicit Solvers(size_t cacheEntries) : cache(cacheEntries) {}
+
+    // Throws if the request cannot be solved, with a message fit to send back to the client
+    std::string solve(const Request &request);
+};
+
+}
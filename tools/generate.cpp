@@ -0,0 +1,52 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include <iostream>
+#include <format>
+#include <string_view>
+#include <stdexcept>
+
+#include "generators.h"
+
+// Writes a generated input to stdout, e.g. generate day18 --size=200 > big.txt
+int main(int argc, char **argv)
+try {
+    if (argc < 2) {
+        std::cerr << "Usage: generate day11|day12|day13|day14|day15|day16|day18 [--seed=N] [--knob=value ...]"
+                  << std::endl;
+        return 1;
+    }
+    std::string_view day = argv[1];
+    generate::Options options;
+    for (int i = 2; i < argc; i++) {
+        std::string_view arg = argv[i];
+        auto equals = arg.find('=');
+        if (!arg.starts_with("--") || equals == std::string_view::npos) {
+            throw std::runtime_error(std::format("Expected --name=value but got '{}'", arg));
+        }
+        options.set(arg.substr(2, equals - 2), arg.substr(equals + 1));
+    }
+
+    std::ios::sync_with_stdio(false);
+    generate::write(day, options, std::cout);
+    std::cout.flush();
+    if (day == "day15") {
+        std::cerr << std::format("Row argument for this input: {}", generate::day15Row(options)) << std::endl;
+    }
+    return 0;
+} catch (const std::exception &ex) {
+    std::cerr << "ERROR: " << ex.what() << std::endl;
+    return 1;
+}
@@ -0,0 +1,337 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#include "generators.h"
+
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <random>
+
+namespace generate {
+
+namespace {
+    /**
+     * A seeded source of numbers that does not depend on the standard library's distributions,
+     * which are free to differ between implementations.
+     */
+    class Random {
+        std::mt19937_64 engine;
+
+    public:
+        explicit Random(uint64_t seed) : engine(seed) {}
+
+        // Slightly biased towards small values for huge n, which does not matter here
+        uint64_t below(uint64_t n) { return engine() % n; }
+
+        int64_t between(int64_t min, int64_t max) { return min + int64_t(below(uint64_t(max - min + 1))); }
+
+        bool chance(unsigned percent) { return below(100) < percent; }
+
+        template<typename T>
+        void shuffle(std::vector<T> &values) {
+            for (size_t i = values.size(); i > 1; i--) {
+                std::swap(values[i - 1], values[below(i)]);
+            }
+        }
+    };
+
+    void generateDay11(Options &options, Random &random, std::ostream &out) {
+        // The solver keeps worry levels modulo the product of the divisors and squares them, so
+        // the product has to stay below 2^32, which the first nine primes just manage
+        constexpr uint64_t Primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23};
+        auto monkeys = options.get<size_t>("monkeys", 8, 2, std::size(Primes));
+        auto items = options.get<size_t>("items", 36, monkeys, 100'000'000);
+        options.checkAllUsed();
+
+        std::vector<uint64_t> divisors(Primes, Primes + monkeys);
+        random.shuffle(divisors);
+        for (size_t m = 0; m < monkeys; m++) {
+            out << std::format("Monkey {}:\n", m);
+            out << "  Starting items: ";
+            // Every monkey starts with at least one item
+            auto count = items / monkeys + (m < items % monkeys ? 1 : 0);
+            for (size_t i = 0; i < count; i++) {
+                out << (i == 0 ? "" : ", ") << random.between(50, 99);
+            }
+            out << '\n';
+
+            switch (random.below(3)) {
+                case 0:
+                    out << std::format("  Operation: new = old * {}\n", random.between(2, 19));
+                    break;
+                case 1:
+                    out << std::format("  Operation: new = old + {}\n", random.between(1, 8));
+                    break;
+                default:
+                    out << "  Operation: new = old * old\n";
+                    break;
+            }
+            out << std::format("  Test: divisible by {}\n", divisors[m]);
+
+            // Items are never thrown back to the monkey holding them
+            auto trueTarget = (m + 1 + random.below(monkeys - 1)) % monkeys;
+            auto falseTarget = trueTarget;
+            if (monkeys > 2) {
+                do {
+                    falseTarget = random.below(monkeys);
+                } while (falseTarget == m || falseTarget == trueTarget);
+            }
+            out << std::format("    If true: throw to monkey {}\n", trueTarget);
+            out << std::format("    If false: throw to monkey {}\n", falseTarget);
+            if (m + 1 < monkeys) {
+                out << '\n';
+            }
+        }
+    }
+
+    void generateDay12(Options &options, Random &random, std::ostream &out) {
+        auto width = options.get<size_t>("width", 160, 26, 1'000'000);
+        auto height = options.get<size_t>("height", 40, 1, 1'000'000);
+        auto dips = options.get<unsigned>("dips", 30, 0, 100);
+        options.checkAllUsed();
+
+        // The ground climbs from a to z left to right. Dips of one step anywhere but the top row
+        // leave that row and every column climbable, so E can always be reached from S.
+        auto start = random.below(height);
+        auto end = random.below(height);
+        std::string row;
+        for (size_t y = 0; y < height; y++) {
+            row.clear();
+            for (size_t x = 0; x < width; x++) {
+                auto h = int(x * 26 / width);
+                if (y > 0 && h > 0 && random.chance(dips)) {
+                    h--;
+                }
+                row += char('a' + h);
+            }
+            if (y == start) {
+                row.front() = 'S';
+            }
+            if (y == end) {
+                row.back() = 'E';
+            }
+            out << row << '\n';
+        }
+    }
+
+    void writePacket(Random &random, std::ostream &out, unsigned depth, unsigned width) {
+        out << '[';
+        auto count = random.below(width + 1);
+        for (size_t i = 0; i < count; i++) {
+            if (i > 0) {
+                out << ',';
+            }
+            if (depth > 1 && random.chance(40)) {
+                writePacket(random, out, depth - 1, width);
+            } else {
+                out << random.below(11);
+            }
+        }
+        out << ']';
+    }
+
+    void generateDay13(Options &options, Random &random, std::ostream &out) {
+        auto pairs = options.get<size_t>("pairs", 150, 1, 100'000'000);
+        auto depth = options.get<unsigned>("depth", 5, 1, 1000);
+        auto width = options.get<unsigned>("width", 5, 1, 1000);
+        options.checkAllUsed();
+
+        for (size_t i = 0; i < pairs; i++) {
+            writePacket(random, out, depth, width);
+            out << '\n';
+            writePacket(random, out, depth, width);
+            out << '\n';
+            if (i + 1 < pairs) {
+                out << '\n';
+            }
+        }
+    }
+
+    void generateDay14(Options &options, Random &random, std::ostream &out) {
+        auto paths = options.get<size_t>("paths", 150, 1, 100'000'000);
+        auto depth = options.get<int>("depth", 170, 4, 100'000);
+        auto segments = options.get<unsigned>("segments", 4, 1, 1000);
+        options.checkAllUsed();
+
+        // Paths sit within the pile of sand that settles on the floor, below the source at 500,0
+        for (size_t i = 0; i < paths; i++) {
+            int y = int(random.between(depth / 4, depth));
+            int x = int(random.between(500 - y, 500 + y));
+            out << x << ',' << y;
+            for (unsigned s = 0; s < segments; s++) {
+                auto length = int(random.between(1, 8));
+                if (s % 2 == 0) {
+                    x += random.chance(50) ? length : -length;
+                } else {
+                    // Stay within the depth, and never draw a zero length segment, which the
+                    // solver cannot walk along
+                    auto up = y - 1;
+                    auto down = depth - y;
+                    if (down > 0 && (up == 0 || random.chance(50))) {
+                        y += std::min(length, down);
+                    } else {
+                        y -= std::min(length, up);
+                    }
+                }
+                out << " -> " << x << ',' << y;
+            }
+            out << '\n';
+        }
+    }
+
+    void writeSensor(Random &random, std::ostream &out, int64_t x, int64_t y, int64_t radius) {
+        // Any beacon at exactly the radius gives the sensor that reach
+        auto dx = random.between(0, radius);
+        auto dy = radius - dx;
+        auto beaconX = x + (random.chance(50) ? dx : -dx);
+        auto beaconY = y + (random.chance(50) ? dy : -dy);
+        out << std::format("Sensor at x={}, y={}: closest beacon is at x={}, y={}\n", x, y, beaconX, beaconY);
+    }
+
+    int64_t day15Size(Options &options) {
+        return options.get<int64_t>("size", 4'000'000, 4, 500'000'000) & ~int64_t(1);
+    }
+
+    void generateDay15(Options &options, Random &random, std::ostream &out) {
+        auto size = day15Size(options);
+        auto sensors = options.get<int64_t>("sensors", 30, 1, 10'000'000);
+        options.checkAllUsed();
+
+        // Sensors on a lattice with spacing s and reach s cover the whole square between them.
+        // Those within s of the hidden beacon are left out, and four sensors diagonally 2s away
+        // cover everything within 2s of it other than the beacon itself.
+        auto perSide = std::max<int64_t>(1, std::llround(std::sqrt(double(sensors))));
+        auto spacing = std::max<int64_t>(1, (size + perSide - 1) / perSide);
+        auto hiddenX = random.between(1, size - 1);
+        auto hiddenY = random.between(1, size - 1);
+        for (int64_t y = 0; y < size + spacing; y += spacing) {
+            for (int64_t x = 0; x < size + spacing; x += spacing) {
+                if (std::abs(x - hiddenX) + std::abs(y - hiddenY) > spacing) {
+                    writeSensor(random, out, x, y, spacing);
+                }
+            }
+        }
+        auto offset = 2 * spacing;
+        for (auto [dx, dy]: {std::pair{1, 1}, std::pair{1, -1}, std::pair{-1, 1}, std::pair{-1, -1}}) {
+            writeSensor(random, out, hiddenX + dx * offset, hiddenY + dy * offset, 2 * offset - 1);
+        }
+    }
+
+    void generateDay16(Options &options, Random &random, std::ostream &out) {
+        auto valves = options.get<size_t>("valves", 60, 2, 26 * 26);
+        auto useful = options.get<size_t>("useful", 15, 1, std::min<size_t>(31, valves - 1));
+        auto extra = options.get<size_t>("extra", valves / 4, 0, valves * valves);
+        options.checkAllUsed();
+
+        // AA comes first and never has flow, like the real puzzle
+        std::vector<std::string> names;
+        for (char a = 'A'; a <= 'Z'; a++) {
+            for (char b = 'A'; b <= 'Z'; b++) {
+                names.push_back({a, b});
+            }
+        }
+        std::vector<std::string> picked(names.begin() + 1, names.end());
+        random.shuffle(picked);
+        picked.resize(valves - 1);
+        picked.insert(picked.begin(), "AA");
+
+        // A random spanning tree keeps every valve reachable, then extra tunnels add loops
+        std::vector<std::vector<size_t>> tunnels(valves);
+        auto connect = [&](size_t a, size_t b) {
+            if (a != b && std::find(tunnels[a].begin(), tunnels[a].end(), b) == tunnels[a].end()) {
+                tunnels[a].push_back(b);
+                tunnels[b].push_back(a);
+            }
+        };
+        for (size_t v = 1; v < valves; v++) {
+            connect(v, random.below(v));
+        }
+        for (size_t e = 0; e < extra; e++) {
+            connect(random.below(valves), random.below(valves));
+        }
+
+        std::vector<size_t> rates(valves, 0);
+        std::vector<size_t> order(valves - 1);
+        std::iota(order.begin(), order.end(), 1);
+        random.shuffle(order);
+        for (size_t i = 0; i < useful; i++) {
+            rates[order[i]] = random.between(1, 25);
+        }
+
+        for (size_t v = 0; v < valves; v++) {
+            out << std::format("Valve {} has flow rate={}; ", picked[v], rates[v]);
+            out << (tunnels[v].size() == 1 ? "tunnel leads to valve " : "tunnels lead to valves ");
+            for (size_t i = 0; i < tunnels[v].size(); i++) {
+                out << (i == 0 ? "" : ", ") << picked[tunnels[v][i]];
+            }
+            out << '\n';
+        }
+    }
+
+    void generateDay18(Options &options, Random &random, std::ostream &out) {
+        auto size = options.get<uint32_t>("size", 20, 1, 100'000);
+        auto density = options.get<unsigned>("density", 90, 1, 100);
+        options.checkAllUsed();
+
+        // A ball of lava with random holes, which at high densities are mostly sealed pockets
+        std::vector<std::array<uint32_t, 3>> cubes;
+        auto centre = double(size - 1) / 2;
+        auto radius = double(size) / 2;
+        for (uint32_t z = 0; z < size; z++) {
+            for (uint32_t y = 0; y < size; y++) {
+                for (uint32_t x = 0; x < size; x++) {
+                    auto dx = x - centre;
+                    auto dy = y - centre;
+                    auto dz = z - centre;
+                    if (dx * dx + dy * dy + dz * dz <= radius * radius && random.chance(density)) {
+                        cubes.push_back({x, y, z});
+                    }
+                }
+            }
+        }
+        random.shuffle(cubes);
+        for (const auto &[x, y, z]: cubes) {
+            out << x << ',' << y << ',' << z << '\n';
+        }
+    }
+}
+
+void write(std::string_view day, Options &options, std::ostream &out) {
+    Random random(options.get<uint64_t>("seed", 2022, 0, UINT64_MAX));
+    if (day == "day11") {
+        generateDay11(options, random, out);
+    } else if (day == "day12") {
+        generateDay12(options, random, out);
+    } else if (day == "day13") {
+        generateDay13(options, random, out);
+    } else if (day == "day14") {
+        generateDay14(options, random, out);
+    } else if (day == "day15") {
+        generateDay15(options, random, out);
+    } else if (day == "day16") {
+        generateDay16(options, random, out);
+    } else if (day == "day18") {
+        generateDay18(options, random, out);
+    } else {
+        throw std::runtime_error(std::format("Unknown day '{}'", day));
+    }
+}
+
+int64_t day15Row(Options &options) {
+    return day15Size(options) / 2;
+}
+
+}
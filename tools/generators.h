@@ -0,0 +1,78 @@
+//   Copyright 17/10/2026 William Marlow
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <format>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aoc/number.h"
+
+/**
+ * Writes arbitrarily large, valid puzzle inputs, so that the solvers can be measured well past
+ * the size of the real inputs. Each day takes --name=value knobs whose defaults roughly match
+ * the real input; the same knobs and seed always give the same output.
+ */
+namespace generate {
+
+class Options {
+    std::map<std::string, std::string, std::less<>> values;
+    std::vector<std::string> used;
+
+public:
+    void set(std::string_view name, std::string_view value) { values.insert_or_assign(std::string(name), value); }
+
+    /**
+     * Returns the value of a knob, or its default when it was not given. Every knob a
+     * generator asks for is marked as used, so that it can report misspelt ones before
+     * writing anything.
+     */
+    template<typename T>
+    T get(std::string_view name, T fallback, T min, T max) {
+        used.emplace_back(name);
+        auto it = values.find(name);
+        if (it == values.end()) {
+            return fallback;
+        }
+        auto value = aoc::parseNumber<T>(it->second);
+        if (value < min || value > max) {
+            throw std::runtime_error(std::format("--{} must be between {} and {}", name, min, max));
+        }
+        return value;
+    }
+
+    void checkAllUsed() const {
+        for (const auto &[name, _]: values) {
+            if (std::find(used.begin(), used.end(), name) == used.end()) {
+                throw std::runtime_error(std::format("Unknown option --{}", name));
+            }
+        }
+    }
+};
+
+// Writes an input for day, one of day11 to day16 or day18, seeded by the seed knob
+void write(std::string_view day, Options &options, std::ostream &out);
+
+// The row that a day15 input written with these options should be asked about
+int64_t day15Row(Options &options);
+
+}